@@ -0,0 +1,285 @@
+/*
+ *
+ *	C source file containing the implementation of
+ *	the AuditCache ADT
+ *
+ *	Go to header file for more information
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "auditCache.h"
+
+/*
+ * initAuditCache() takes a cost limit as an argument,
+ * allocates heap space for an AuditCache with a hash
+ * table of about one bucket for every four units of
+ * cost (a power of two, at least 16), and returns a
+ * pointer to the new, empty AuditCache
+ */
+AuditCache* initAuditCache(unsigned int costLimit) {
+
+	// allocating heap space
+	AuditCache *cachePtr = (AuditCache*) malloc(sizeof(AuditCache));
+	// filling in data members
+	cachePtr->numBuckets = 16;
+	while (cachePtr->numBuckets < costLimit / 4) {
+		cachePtr->numBuckets *= 2;
+	}
+	cachePtr->buckets = (AuditCacheEntry**) calloc(cachePtr->numBuckets, sizeof(AuditCacheEntry*));
+	cachePtr->newest = NULL;
+	cachePtr->oldest = NULL;
+	cachePtr->numEntries = 0;
+	cachePtr->totalCost = 0;
+	cachePtr->costLimit = costLimit;
+	cachePtr->hits = 0;
+	cachePtr->misses = 0;
+	cachePtr->staleMisses = 0;
+	cachePtr->evictions = 0;
+	return cachePtr;
+}
+
+/*
+ * freeAuditCache() takes an AuditCache pointer as an
+ * argument and frees every result, every entry, the
+ * hash table, and the AuditCache
+ */
+void freeAuditCache(AuditCache *cachePtr) {
+
+	if (cachePtr == NULL) {
+		return;
+	}
+	AuditCacheEntry *entryPtr = cachePtr->newest;
+	while (entryPtr != NULL) {
+		AuditCacheEntry *olderPtr = entryPtr->older;
+		freeVector(entryPtr->result);
+		free(entryPtr);
+		entryPtr = olderPtr;
+	}
+	free(cachePtr->buckets);
+	free(cachePtr);
+	return;
+}
+
+/*
+ * bucketOf() takes an AuditCache pointer, a Student
+ * pointer, and a command as arguments and returns the
+ * index of the hash chain for them
+ *
+ * Student addresses are spread by a multiplicative hash
+ * so that their alignment does not crowd the buckets
+ */
+unsigned int bucketOf(AuditCache *cachePtr, Student *studentPtr, int command) {
+
+	uint64_t hash = ( (uint64_t) (uintptr_t) studentPtr * 2 + (uint64_t) command ) * 0x9e3779b97f4a7c15ULL;
+	return (unsigned int) (hash >> 32) & (cachePtr->numBuckets - 1);
+}
+
+/*
+ * unlinkEntry() takes an AuditCache pointer and an entry
+ * pointer as arguments and takes the entry out of the
+ * most to least recently used list
+ */
+void unlinkEntry(AuditCache *cachePtr, AuditCacheEntry *entryPtr) {
+
+	if (entryPtr->newer == NULL) {
+		cachePtr->newest = entryPtr->older;
+	} else {
+		entryPtr->newer->older = entryPtr->older;
+	}
+	if (entryPtr->older == NULL) {
+		cachePtr->oldest = entryPtr->newer;
+	} else {
+		entryPtr->older->newer = entryPtr->newer;
+	}
+	return;
+}
+
+/*
+ * linkNewest() takes an AuditCache pointer and an entry
+ * pointer as arguments and puts the entry at the front
+ * of the most to least recently used list
+ */
+void linkNewest(AuditCache *cachePtr, AuditCacheEntry *entryPtr) {
+
+	entryPtr->newer = NULL;
+	entryPtr->older = cachePtr->newest;
+	if (cachePtr->newest == NULL) {
+		cachePtr->oldest = entryPtr;
+	} else {
+		cachePtr->newest->newer = entryPtr;
+	}
+	cachePtr->newest = entryPtr;
+	return;
+}
+
+/*
+ * removeEntry() takes an AuditCache pointer and an entry
+ * pointer as arguments and takes the entry out of its
+ * hash chain and the list, then frees its result and
+ * the entry
+ */
+void removeEntry(AuditCache *cachePtr, AuditCacheEntry *entryPtr) {
+
+	AuditCacheEntry **linkPtr = cachePtr->buckets + bucketOf(cachePtr, entryPtr->studentPtr, entryPtr->command);
+	while (*linkPtr != entryPtr) {
+		linkPtr = &(*linkPtr)->nextInBucket;
+	}
+	*linkPtr = entryPtr->nextInBucket;
+	unlinkEntry(cachePtr, entryPtr);
+	cachePtr->numEntries--;
+	cachePtr->totalCost -= entryPtr->cost;
+	freeVector(entryPtr->result);
+	free(entryPtr);
+	return;
+}
+
+/*
+ * findEntry() takes an AuditCache pointer, a Student
+ * pointer, and a command as arguments and returns the
+ * Student's entry for the command, current or not, or
+ * NULL if there is none
+ */
+AuditCacheEntry* findEntry(AuditCache *cachePtr, Student *studentPtr, int command) {
+
+	AuditCacheEntry *entryPtr = cachePtr->buckets[bucketOf(cachePtr, studentPtr, command)];
+	while (entryPtr != NULL && (entryPtr->studentPtr != studentPtr || entryPtr->command != command)) {
+		entryPtr = entryPtr->nextInBucket;
+	}
+	return entryPtr;
+}
+
+/*
+ * findAuditResult() takes an AuditCache pointer, a
+ * Student pointer, a command, a Degree pointer, and a
+ * CourseBinaryTree pointer as arguments
+ *
+ * findAuditResult() looks up the Student's entry for the
+ * command - if all of its versions match it is a hit and
+ * becomes the most recently used, if they do not it is
+ * removed and counted as a stale miss
+ *
+ * returns the cached result Vector, or NULL for a miss
+ */
+Vector* findAuditResult(AuditCache *cachePtr, Student *studentPtr, int command, Degree *degreePtr, CourseBinaryTree *courseTreePtr) {
+
+	// checking for NULL pointer arguments
+	if (cachePtr == NULL || studentPtr == NULL || degreePtr == NULL || courseTreePtr == NULL) {
+		printf("\nCannot find an audit result with "
+				"NULL AuditCache, Student, "
+				"Degree, or CourseBinaryTree "
+				"pointer argument\n");
+		return NULL;
+	}
+
+	AuditCacheEntry *entryPtr = findEntry(cachePtr, studentPtr, command);
+	if (entryPtr == NULL) {
+		cachePtr->misses++;
+		return NULL;
+	}
+	if (entryPtr->studentVersion != studentPtr->completedCourses->version
+			|| entryPtr->degreeCourses != degreePtr->reqCourses
+			|| entryPtr->degreeVersion != degreePtr->reqCourses->version
+			|| entryPtr->catalogVersion != courseTreePtr->version) {
+		removeEntry(cachePtr, entryPtr);
+		cachePtr->misses++;
+		cachePtr->staleMisses++;
+		return NULL;
+	}
+
+	unlinkEntry(cachePtr, entryPtr);
+	linkNewest(cachePtr, entryPtr);
+	cachePtr->hits++;
+	return entryPtr->result;
+}
+
+/*
+ * storeAuditResult() takes an AuditCache pointer, a
+ * Student pointer, a command, a Degree pointer, a
+ * CourseBinaryTree pointer, and a result Vector pointer
+ * as arguments
+ *
+ * storeAuditResult() replaces any entry the Student has
+ * for the command, evicts the least recently used
+ * entries until the result fits under the cost limit,
+ * and adds the result with the current versions as the
+ * most recently used
+ *
+ * returns true if the AuditCache now owns the result and
+ * false if the result alone is over the cost limit (or
+ * for error)
+ */
+bool storeAuditResult(AuditCache *cachePtr, Student *studentPtr, int command, Degree *degreePtr, CourseBinaryTree *courseTreePtr, Vector *result) {
+
+	// checking for NULL pointer arguments
+	if (cachePtr == NULL || studentPtr == NULL || degreePtr == NULL || courseTreePtr == NULL || result == NULL) {
+		printf("\nCannot store an audit result with "
+				"NULL AuditCache, Student, "
+				"Degree, CourseBinaryTree, or "
+				"Vector pointer argument\n");
+		return false;
+	}
+
+	unsigned int cost = 1 + result->numElements;
+	if (cost > cachePtr->costLimit) {
+		return false;
+	}
+	AuditCacheEntry *oldEntryPtr = findEntry(cachePtr, studentPtr, command);
+	if (oldEntryPtr != NULL) {
+		removeEntry(cachePtr, oldEntryPtr);
+	}
+	while (cachePtr->totalCost + cost > cachePtr->costLimit) {
+		removeEntry(cachePtr, cachePtr->oldest);
+		cachePtr->evictions++;
+	}
+
+	// allocating heap space
+	AuditCacheEntry *entryPtr = (AuditCacheEntry*) malloc(sizeof(AuditCacheEntry));
+	// filling in data members
+	entryPtr->studentPtr = studentPtr;
+	entryPtr->command = command;
+	entryPtr->studentVersion = studentPtr->completedCourses->version;
+	entryPtr->degreeCourses = degreePtr->reqCourses;
+	entryPtr->degreeVersion = degreePtr->reqCourses->version;
+	entryPtr->catalogVersion = courseTreePtr->version;
+	entryPtr->result = result;
+	entryPtr->cost = cost;
+
+	unsigned int bucket = bucketOf(cachePtr, studentPtr, command);
+	entryPtr->nextInBucket = cachePtr->buckets[bucket];
+	cachePtr->buckets[bucket] = entryPtr;
+	linkNewest(cachePtr, entryPtr);
+	cachePtr->numEntries++;
+	cachePtr->totalCost += cost;
+	return true;
+}
+
+/*
+ * printAuditCacheStats() takes an AuditCache pointer as
+ * an argument and prints its lookups, how many were hits
+ * and misses (and how many misses found a result that
+ * was no longer current), its evictions, and how much
+ * of its cost limit it uses
+ */
+void printAuditCacheStats(AuditCache *cachePtr) {
+
+	// checking for NULL pointer argument
+	if (cachePtr == NULL) {
+		printf("\nCannot print the statistics of an "
+				"AuditCache with NULL AuditCache "
+				"pointer argument\n");
+		return;
+	}
+
+	unsigned long numLookups = cachePtr->hits + cachePtr->misses;
+	double hitRate = (numLookups == 0) ? 0.0 : 100.0 * cachePtr->hits / numLookups;
+	printf("\nAudit cache (m and n results):\n");
+	printf("%lu lookups: %lu hits, %lu misses (%lu no longer current), %.1f%% hit rate\n",
+			numLookups, cachePtr->hits, cachePtr->misses, cachePtr->staleMisses, hitRate);
+	printf("%u results held, cost %u of %u, %lu evicted\n",
+			cachePtr->numEntries, cachePtr->totalCost, cachePtr->costLimit, cachePtr->evictions);
+	return;
+}
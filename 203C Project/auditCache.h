@@ -0,0 +1,161 @@
+/*
+ *
+ *	Header file for the AuditCache ADT interface
+ *
+ *	An AuditCache keeps the results of the 'm' (Courses
+ *	a Student still needs) and 'n' (Degree Courses a
+ *	Student can take next) commands, so asking about the
+ *	same Student again costs a lookup instead of an
+ *	audit.
+ *
+ *	A result is keyed by the Student and the command,
+ *	and is only current while three versions match the
+ *	ones it was computed at:
+ *		the Student's completed Courses (bumped by
+ *		addCompletedCourse() and by removing a Course
+ *		from all Students)
+ *		the Degree's required Courses (bumped by
+ *		removeCourseFromDegree() and by removing a
+ *		Course from all Degrees)
+ *		the CourseBinaryTree (bumped by inserting or
+ *		removing a Course or compiling prerequisites,
+ *		as addCourseToDepartment() and removing a
+ *		Course from all do)
+ *	A result that is no longer current is thrown away
+ *	when it is next looked up.
+ *
+ *	Results are found through a hash table of chains
+ *	and are also kept on a list from most to least
+ *	recently used. The memory is bounded by a cost
+ *	limit - one for each result plus one for each
+ *	Element of its Vector - and the least recently used
+ *	results are evicted to stay within it.
+ *
+ */
+
+#ifndef AUDITCACHE_H
+#define AUDITCACHE_H
+
+#include "student.h"
+#include "coursePtrVector.h"
+#include "courseBT.h"
+
+// commands whose results are cached
+#define AUDIT_STILL_NEEDED 0
+#define AUDIT_AVAILABLE 1
+
+// default cost limit of an AuditCache
+#define AUDIT_CACHE_COST_LIMIT 4096
+
+// struct for one cached result
+//
+// nextInBucket links the results of one hash chain,
+// newer and older link the most to least recently
+// used list
+typedef struct auditCacheEntry {
+	Student *studentPtr;
+	int command;
+	unsigned int studentVersion;
+	Vector *degreeCourses;
+	unsigned int degreeVersion;
+	unsigned int catalogVersion;
+	Vector *result;
+	unsigned int cost;
+	struct auditCacheEntry *nextInBucket;
+	struct auditCacheEntry *newer;
+	struct auditCacheEntry *older;
+} AuditCacheEntry;
+
+// struct for the cache of audit results
+typedef struct auditCache {
+	unsigned int numBuckets;
+	AuditCacheEntry **buckets;
+	AuditCacheEntry *newest;
+	AuditCacheEntry *oldest;
+	unsigned int numEntries;
+	unsigned int totalCost;
+	unsigned int costLimit;
+	unsigned long hits;
+	unsigned long misses;
+	unsigned long staleMisses;
+	unsigned long evictions;
+} AuditCache;
+
+
+// AuditCache interface
+
+/*
+ * allocates heap space for an empty
+ * AuditCache and returns a pointer to it
+ *
+ * costLimit - most results plus result
+ * Elements the AuditCache may hold
+ */
+AuditCache* initAuditCache(unsigned int costLimit);
+
+/*
+ * frees an AuditCache and every result
+ * it holds
+ *
+ * cachePtr - pointer to the AuditCache
+ * to free
+ */
+void freeAuditCache(AuditCache* cachePtr);
+
+/*
+ * returns the cached result of a command
+ * for a Student if it is current, making
+ * it the most recently used, and NULL
+ * otherwise - the AuditCache keeps owning
+ * the result
+ *
+ * cachePtr - pointer to the AuditCache
+ *
+ * studentPtr - pointer to the Student
+ *
+ * command - AUDIT_STILL_NEEDED or
+ * AUDIT_AVAILABLE
+ *
+ * degreePtr - pointer to the Student's
+ * Degree
+ *
+ * courseTreePtr - pointer to the
+ * CourseBinaryTree of every Course
+ */
+Vector* findAuditResult(AuditCache* cachePtr, Student* studentPtr, int command, Degree* degreePtr, CourseBinaryTree* courseTreePtr);
+
+/*
+ * stores the result of a command for a
+ * Student as the most recently used,
+ * evicting the least recently used results
+ * to stay within the cost limit - returns
+ * true if the AuditCache took ownership of
+ * the result and false if it is too big
+ * to cache
+ *
+ * cachePtr - pointer to the AuditCache
+ *
+ * studentPtr - pointer to the Student
+ *
+ * command - AUDIT_STILL_NEEDED or
+ * AUDIT_AVAILABLE
+ *
+ * degreePtr - pointer to the Student's
+ * Degree
+ *
+ * courseTreePtr - pointer to the
+ * CourseBinaryTree of every Course
+ *
+ * result - pointer to the Vector to cache
+ */
+bool storeAuditResult(AuditCache* cachePtr, Student* studentPtr, int command, Degree* degreePtr, CourseBinaryTree* courseTreePtr, Vector* result);
+
+/*
+ * prints the AuditCache's hits, misses,
+ * evictions, and how much it holds
+ *
+ * cachePtr - pointer to the AuditCache
+ */
+void printAuditCacheStats(AuditCache* cachePtr);
+
+#endif
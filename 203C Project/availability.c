@@ -0,0 +1,310 @@
+/*
+ *
+ *	C source file containing the implementation of
+ *	the Availability ADT
+ *
+ *	Go to header file for more information
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "availability.h"
+
+/*
+ * initAvailability() takes a CourseBinaryTree pointer as
+ * an argument, allocates heap space for an Availability
+ * with no counts and an empty available set, and returns
+ * a pointer to it
+ *
+ * the tree version is left one behind the tree's, so the
+ * Availability is not current until it is built
+ *
+ * returns NULL for error
+ */
+Availability* initAvailability(CourseBinaryTree *courseTreePtr) {
+
+	// checking for NULL pointer argument
+	if (courseTreePtr == NULL) {
+		printf("\nCannot initialize Availability "
+				"with NULL CourseBinaryTree "
+				"pointer argument\n");
+		return NULL;
+	}
+
+	// allocating heap space
+	Availability *availabilityPtr = (Availability*) malloc(sizeof(Availability));
+	// filling in data members
+	availabilityPtr->courseTreePtr = courseTreePtr;
+	availabilityPtr->treeVersion = courseTreePtr->version - 1;
+	availabilityPtr->numCourseIds = 0;
+	availabilityPtr->satisfiedClauses = NULL;
+	availabilityPtr->availableSet = initBitSet(courseTreePtr->numCourseIds);
+	return availabilityPtr;
+}
+
+/*
+ * freeAvailability() takes an Availability pointer as an
+ * argument and frees its counts, its BitSet, and the
+ * Availability
+ */
+void freeAvailability(Availability *availabilityPtr) {
+
+	if (availabilityPtr == NULL) {
+		return;
+	}
+	free(availabilityPtr->satisfiedClauses);
+	freeBitSet(availabilityPtr->availableSet);
+	free(availabilityPtr);
+	return;
+}
+
+/*
+ * isAvailabilityCurrent() takes an Availability pointer
+ * as an argument and returns true if it was built
+ * against the current version of its CourseBinaryTree
+ */
+bool isAvailabilityCurrent(Availability *availabilityPtr) {
+
+	return availabilityPtr != NULL && availabilityPtr->treeVersion == availabilityPtr->courseTreePtr->version;
+}
+
+/*
+ * clauseHasOtherCompleted() takes a PrereqExpr pointer,
+ * the index of a clause, a Course id, and a BitSet
+ * pointer of completed Course ids as arguments and
+ * returns true if a Course of the clause other than
+ * the given one is completed
+ */
+bool clauseHasOtherCompleted(PrereqExpr *exprPtr, unsigned int clauseIndex, unsigned int courseId, BitSet *completedPtr) {
+
+	unsigned int *clauseEnds = prereqClauseEnds(exprPtr);
+	unsigned int *courseIds = prereqCourseIds(exprPtr);
+	unsigned int term = (clauseIndex == 0) ? 0 : clauseEnds[clauseIndex - 1];
+	for (; term < clauseEnds[clauseIndex]; term++) {
+		if ( courseIds[term] != courseId && testBit(completedPtr, courseIds[term]) ) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/*
+ * refreshAvailableBit() takes an Availability pointer, a
+ * BitSet pointer of completed Course ids, and a Course
+ * pointer as arguments and sets the Course's available
+ * bit if it is not completed and every clause of its
+ * prerequisites is fulfilled, clearing it otherwise
+ */
+void refreshAvailableBit(Availability *availabilityPtr, BitSet *completedPtr, Course *coursePtr) {
+
+	unsigned int numClauses = (coursePtr->prereqExpr == NULL) ? 0 : coursePtr->prereqExpr->numClauses;
+	if ( !testBit(completedPtr, coursePtr->id) && availabilityPtr->satisfiedClauses[coursePtr->id] == numClauses ) {
+		setBit(availabilityPtr->availableSet, coursePtr->id);
+	} else {
+		clearBit(availabilityPtr->availableSet, coursePtr->id);
+	}
+	return;
+}
+
+/*
+ * buildAvailability() takes an Availability pointer and a
+ * BitSet pointer of completed Course ids as arguments
+ *
+ * buildAvailability() sizes the counts for every Course id
+ * of the tree, counts the clauses of every Course that
+ * have a completed Course, fills the available set, and
+ * records the tree's version
+ */
+void buildAvailability(Availability *availabilityPtr, BitSet *completedPtr) {
+
+	// checking for NULL pointer arguments
+	if (availabilityPtr == NULL || completedPtr == NULL) {
+		printf("\nCannot build Availability with "
+				"NULL Availability or BitSet "
+				"pointer argument\n");
+		return;
+	}
+
+	CourseBinaryTree *bt = availabilityPtr->courseTreePtr;
+	if (availabilityPtr->numCourseIds != bt->numCourseIds) {
+		free(availabilityPtr->satisfiedClauses);
+		availabilityPtr->numCourseIds = bt->numCourseIds;
+		availabilityPtr->satisfiedClauses = (unsigned short*) malloc( (bt->numCourseIds + 1) * sizeof(unsigned short) );
+	}
+	memset(availabilityPtr->satisfiedClauses, 0, (bt->numCourseIds + 1) * sizeof(unsigned short));
+	clearAllBits(availabilityPtr->availableSet);
+
+	for (unsigned int id = 0; id < bt->numCourseIds; id++) {
+		Course *coursePtr = bt->coursesById[id];
+		if (coursePtr == NULL) {
+			continue;
+		}
+		PrereqExpr *exprPtr = coursePtr->prereqExpr;
+		if (exprPtr != NULL) {
+			unsigned int *clauseEnds = prereqClauseEnds(exprPtr);
+			unsigned int *courseIds = prereqCourseIds(exprPtr);
+			unsigned int term = 0;
+			for (unsigned int i = 0; i < exprPtr->numClauses; i++) {
+				bool fulfilled = false;
+				for (; term < clauseEnds[i]; term++) {
+					fulfilled = fulfilled || testBit(completedPtr, courseIds[term]);
+				}
+				availabilityPtr->satisfiedClauses[id] += fulfilled;
+			}
+		}
+		refreshAvailableBit(availabilityPtr, completedPtr, coursePtr);
+	}
+	availabilityPtr->treeVersion = bt->version;
+	return;
+}
+
+/*
+ * countChangedClauses() takes an Availability pointer, a
+ * BitSet pointer of completed Course ids, the id of a
+ * Course, and whether the Course was just completed (or
+ * is no longer completed) as arguments
+ *
+ * countChangedClauses() visits each Course that requires
+ * the given Course once, adding (or taking away) one for
+ * every clause with the Course where no other Course of
+ * the clause is completed - those clauses are the ones
+ * the Course alone fulfills - and refreshes its
+ * available bit
+ */
+void countChangedClauses(Availability *availabilityPtr, BitSet *completedPtr, unsigned int courseId, bool completed) {
+
+	CourseBinaryTree *bt = availabilityPtr->courseTreePtr;
+	PrereqGraph *graphPtr = getPrereqGraph(bt);
+	if (courseId >= graphPtr->numNodes) {
+		return;
+	}
+	unsigned int previousId = graphPtr->numNodes;
+	for (unsigned int d = graphPtr->dependentStarts[courseId]; d < graphPtr->dependentStarts[courseId + 1]; d++) {
+		unsigned int dependentId = graphPtr->dependents[d];
+		// a Course that has the given Course more than once
+		// is listed once for each, next to each other
+		if (dependentId == previousId) {
+			continue;
+		}
+		previousId = dependentId;
+
+		Course *dependentPtr = bt->coursesById[dependentId];
+		PrereqExpr *exprPtr = dependentPtr->prereqExpr;
+		for (unsigned int i = 0; i < exprPtr->numClauses; i++) {
+			if ( prereqClauseContains(exprPtr, i, courseId) && !clauseHasOtherCompleted(exprPtr, i, courseId, completedPtr) ) {
+				if (completed) {
+					availabilityPtr->satisfiedClauses[dependentId]++;
+				} else {
+					availabilityPtr->satisfiedClauses[dependentId]--;
+				}
+			}
+		}
+		refreshAvailableBit(availabilityPtr, completedPtr, dependentPtr);
+	}
+	return;
+}
+
+/*
+ * addCompletedToAvailability() takes an Availability
+ * pointer, a BitSet pointer of completed Course ids, and
+ * the id of a Course that has just been completed as
+ * arguments
+ *
+ * the completed Course is no longer available, and the
+ * Courses that require it are counted again
+ */
+void addCompletedToAvailability(Availability *availabilityPtr, BitSet *completedPtr, unsigned int courseId) {
+
+	// checking for NULL pointer arguments
+	if (availabilityPtr == NULL || completedPtr == NULL) {
+		printf("\nCannot update Availability with "
+				"NULL Availability or BitSet "
+				"pointer argument\n");
+		return;
+	}
+
+	clearBit(availabilityPtr->availableSet, courseId);
+	countChangedClauses(availabilityPtr, completedPtr, courseId, true);
+	return;
+}
+
+/*
+ * removeCompletedFromAvailability() takes an Availability
+ * pointer, a BitSet pointer of completed Course ids, and
+ * the id of a Course that is no longer completed as
+ * arguments
+ *
+ * the Course may be available again, and the Courses
+ * that require it are counted again
+ */
+void removeCompletedFromAvailability(Availability *availabilityPtr, BitSet *completedPtr, unsigned int courseId) {
+
+	// checking for NULL pointer arguments
+	if (availabilityPtr == NULL || completedPtr == NULL) {
+		printf("\nCannot update Availability with "
+				"NULL Availability or BitSet "
+				"pointer argument\n");
+		return;
+	}
+
+	Course *coursePtr = findCourseById(availabilityPtr->courseTreePtr, courseId);
+	if (coursePtr != NULL) {
+		refreshAvailableBit(availabilityPtr, completedPtr, coursePtr);
+	}
+	countChangedClauses(availabilityPtr, completedPtr, courseId, false);
+	return;
+}
+
+/*
+ * unlockedIfCompleted() takes an Availability pointer, a
+ * BitSet pointer of completed Course ids, the id of a
+ * Course that is not completed, and a BitSet pointer to
+ * fill as arguments
+ *
+ * unlockedIfCompleted() visits each Course that requires
+ * the given Course once and, if it is not available,
+ * adds the clauses the Course alone would fulfill to its
+ * count - if that fulfills every clause, and the Course
+ * is not completed, its id is set in the BitSet
+ */
+void unlockedIfCompleted(Availability *availabilityPtr, BitSet *completedPtr, unsigned int courseId, BitSet *unlockedPtr) {
+
+	// checking for NULL pointer arguments
+	if (availabilityPtr == NULL || completedPtr == NULL || unlockedPtr == NULL) {
+		printf("\nCannot find unlocked Courses with "
+				"NULL Availability or BitSet "
+				"pointer argument\n");
+		return;
+	}
+
+	CourseBinaryTree *bt = availabilityPtr->courseTreePtr;
+	PrereqGraph *graphPtr = getPrereqGraph(bt);
+	if (courseId >= graphPtr->numNodes) {
+		return;
+	}
+	unsigned int previousId = graphPtr->numNodes;
+	for (unsigned int d = graphPtr->dependentStarts[courseId]; d < graphPtr->dependentStarts[courseId + 1]; d++) {
+		unsigned int dependentId = graphPtr->dependents[d];
+		if (dependentId == previousId) {
+			continue;
+		}
+		previousId = dependentId;
+		if ( testBit(availabilityPtr->availableSet, dependentId) || testBit(completedPtr, dependentId) ) {
+			continue;
+		}
+
+		PrereqExpr *exprPtr = bt->coursesById[dependentId]->prereqExpr;
+		unsigned int numSatisfied = availabilityPtr->satisfiedClauses[dependentId];
+		for (unsigned int i = 0; i < exprPtr->numClauses; i++) {
+			if ( prereqClauseContains(exprPtr, i, courseId) && !clauseHasOtherCompleted(exprPtr, i, courseId, completedPtr) ) {
+				numSatisfied++;
+			}
+		}
+		if (numSatisfied == exprPtr->numClauses) {
+			setBit(unlockedPtr, dependentId);
+		}
+	}
+	return;
+}
@@ -0,0 +1,153 @@
+/*
+ *
+ *	Header file for the Availability ADT interface
+ *
+ *	An Availability is the set of Courses a Student can
+ *	take next - not completed, with every prerequisite
+ *	clause fulfilled - kept up to date as Courses are
+ *	completed or removed instead of being worked out
+ *	again for every query.
+ *
+ *	For every Course id it counts how many of the
+ *	Course's prerequisite clauses (see prereqExpr.h)
+ *	have a completed Course. A Course is available when
+ *	that count reaches its number of clauses. When a
+ *	Course is completed or removed, only the Courses
+ *	that have it as a prerequisite (the dependents in
+ *	the PrereqGraph, see prereqGraph.h) are counted
+ *	again, and only in the clauses that have it. The
+ *	same walk answers what completing a Course would
+ *	unlock without changing anything.
+ *
+ *	An Availability is built against one version of the
+ *	CourseBinaryTree. When the tree changes - a Course's
+ *	prerequisites are compiled again, or a Course is
+ *	inserted or removed - the counts no longer match the
+ *	prerequisites and are built again from the completed
+ *	Courses the next time they are needed.
+ *
+ *	Counts take two bytes per Course id, so an
+ *	Availability is only kept for a Student once it has
+ *	been asked for (see getStudentAvailableSet() in
+ *	student.h).
+ *
+ */
+
+#ifndef AVAILABILITY_H
+#define AVAILABILITY_H
+
+#include "courseBT.h"
+#include "prereqGraph.h"
+#include "bitSet.h"
+
+// struct for the available Courses of one Student
+//
+// satisfiedClauses[id] is the number of clauses of Course
+// id with a completed Course, and availableSet holds the
+// ids of the available Courses - both only match the
+// CourseBinaryTree while treeVersion matches its version
+typedef struct availability {
+	CourseBinaryTree *courseTreePtr;
+	unsigned int treeVersion;
+	unsigned int numCourseIds;
+	unsigned short *satisfiedClauses;
+	BitSet *availableSet;
+} Availability;
+
+
+// Availability interface
+
+/*
+ * allocates heap space for an empty
+ * Availability over the Courses of a
+ * CourseBinaryTree and returns a pointer
+ * to it - it is built by
+ * buildAvailability()
+ *
+ * courseTreePtr - pointer to the
+ * CourseBinaryTree of every Course
+ */
+Availability* initAvailability(CourseBinaryTree* courseTreePtr);
+
+/*
+ * frees an Availability, its counts, and
+ * its BitSet
+ *
+ * availabilityPtr - pointer to the
+ * Availability to free
+ */
+void freeAvailability(Availability* availabilityPtr);
+
+/*
+ * returns true if the Availability was
+ * built against the current version of
+ * its CourseBinaryTree
+ *
+ * availabilityPtr - pointer to the
+ * Availability
+ */
+bool isAvailabilityCurrent(Availability* availabilityPtr);
+
+/*
+ * counts every Course's fulfilled clauses
+ * again from the completed Courses and
+ * fills the available set
+ *
+ * availabilityPtr - pointer to the
+ * Availability to build
+ *
+ * completedPtr - pointer to the BitSet of
+ * completed Course ids
+ */
+void buildAvailability(Availability* availabilityPtr, BitSet* completedPtr);
+
+/*
+ * updates the Availability for a Course
+ * that has just been completed
+ *
+ * availabilityPtr - pointer to a current
+ * Availability
+ *
+ * completedPtr - pointer to the BitSet of
+ * completed Course ids, with the Course
+ * already set
+ *
+ * courseId - id of the completed Course
+ */
+void addCompletedToAvailability(Availability* availabilityPtr, BitSet* completedPtr, unsigned int courseId);
+
+/*
+ * updates the Availability for a Course
+ * that is no longer completed
+ *
+ * availabilityPtr - pointer to a current
+ * Availability
+ *
+ * completedPtr - pointer to the BitSet of
+ * completed Course ids, with the Course
+ * already cleared
+ *
+ * courseId - id of the Course
+ */
+void removeCompletedFromAvailability(Availability* availabilityPtr, BitSet* completedPtr, unsigned int courseId);
+
+/*
+ * sets the id of every Course that would
+ * become available if the given Course were
+ * completed in the BitSet, without changing
+ * the Availability
+ *
+ * availabilityPtr - pointer to a current
+ * Availability
+ *
+ * completedPtr - pointer to the BitSet of
+ * completed Course ids, without the Course
+ *
+ * courseId - id of the Course
+ *
+ * unlockedPtr - pointer to the BitSet to set
+ * the ids in
+ */
+void unlockedIfCompleted(Availability* availabilityPtr, BitSet* completedPtr, unsigned int courseId, BitSet* unlockedPtr);
+
+#endif
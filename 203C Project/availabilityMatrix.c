@@ -0,0 +1,218 @@
+/*
+ *
+ *	C source file containing the implementation of
+ *	the AvailabilityMatrix ADT
+ *
+ *	Go to header file for more information
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "availabilityMatrix.h"
+
+// 64-bit words in a StudentBlock
+#define BLOCK_WORDS (BLOCK_STUDENTS / 64)
+
+/*
+ * allocateBlocks() takes a number of StudentBlocks as an
+ * argument and returns zeroed heap space for them,
+ * aligned for the vector type
+ */
+StudentBlock* allocateBlocks(size_t numBlocks) {
+
+	// always room for one block, so aligned_alloc() is
+	// never asked for nothing
+	size_t size = (numBlocks + 1) * sizeof(StudentBlock);
+	StudentBlock *blocks = (StudentBlock*) aligned_alloc(sizeof(StudentBlock), size);
+	memset(blocks, 0, size);
+	return blocks;
+}
+
+/*
+ * buildAvailabilityMatrix() takes a CompletionStore
+ * pointer and a CourseBinaryTree pointer as arguments
+ *
+ * buildAvailabilityMatrix() copies each Course column of
+ * the CompletionStore into the blocks - the column's
+ * 64-bit words go straight into the lanes of the blocks,
+ * since both number Students by row - and evaluates the
+ * available Courses
+ *
+ * returns NULL for error
+ */
+AvailabilityMatrix* buildAvailabilityMatrix(CompletionStore *storePtr, CourseBinaryTree *courseTreePtr) {
+
+	// checking for NULL pointer arguments
+	if (storePtr == NULL || courseTreePtr == NULL) {
+		printf("\nCannot build AvailabilityMatrix "
+				"with NULL CompletionStore or "
+				"CourseBinaryTree pointer "
+				"argument\n");
+		return NULL;
+	}
+
+	// allocating heap space
+	AvailabilityMatrix *matrixPtr = (AvailabilityMatrix*) malloc(sizeof(AvailabilityMatrix));
+	// filling in data members
+	matrixPtr->courseTreePtr = courseTreePtr;
+	matrixPtr->numStudents = storePtr->numStudents;
+	matrixPtr->numBlocks = (storePtr->numStudents + BLOCK_STUDENTS - 1) / BLOCK_STUDENTS;
+	matrixPtr->numCourseIds = courseTreePtr->numCourseIds;
+	size_t numEntries = (size_t) matrixPtr->numBlocks * matrixPtr->numCourseIds;
+	matrixPtr->completed = allocateBlocks(numEntries);
+	matrixPtr->available = allocateBlocks(numEntries);
+
+	// Course columns of the store were sized by the tree
+	// when it was built, so newer Course ids have none
+	unsigned int numColumns = storePtr->numCourseColumns;
+	if (numColumns > matrixPtr->numCourseIds) {
+		numColumns = matrixPtr->numCourseIds;
+	}
+	for (unsigned int id = 0; id < numColumns; id++) {
+		BitSet *columnPtr = storePtr->courseColumns[id];
+		if (columnPtr == NULL) {
+			continue;
+		}
+		for (unsigned int w = 0; w < columnPtr->numWords && w / BLOCK_WORDS < matrixPtr->numBlocks; w++) {
+			matrixPtr->completed[(size_t) (w / BLOCK_WORDS) * matrixPtr->numCourseIds + id][w % BLOCK_WORDS] = columnPtr->words[w];
+		}
+	}
+
+	evaluateAvailabilityMatrix(matrixPtr);
+	return matrixPtr;
+}
+
+/*
+ * blockRowMask() takes a StudentBlock pointer, the number
+ * of Students, and the index of a block as arguments and
+ * sets a bit of the StudentBlock for each of the block's
+ * rows that is a Student
+ *
+ * the StudentBlock is filled through a pointer rather
+ * than returned, so the calling convention for vector
+ * types does not depend on the instruction set
+ */
+void blockRowMask(StudentBlock *maskPtr, unsigned int numStudents, unsigned int block) {
+
+	StudentBlock mask;
+	for (unsigned int lane = 0; lane < BLOCK_WORDS; lane++) {
+		unsigned int firstRow = block * BLOCK_STUDENTS + lane * 64;
+		if (firstRow + 64 <= numStudents) {
+			mask[lane] = ~(uint64_t) 0;
+		} else if (firstRow < numStudents) {
+			mask[lane] = ( (uint64_t) 1 << (numStudents - firstRow) ) - 1;
+		} else {
+			mask[lane] = 0;
+		}
+	}
+	*maskPtr = mask;
+	return;
+}
+
+/*
+ * evaluateAvailabilityMatrix() takes an AvailabilityMatrix
+ * pointer as an argument
+ *
+ * evaluateAvailabilityMatrix() walks the blocks one after
+ * the other and, for each Course id of a block, ANDs
+ * together the OR of each prerequisite clause's completed
+ * blocks, leaving out the Students who have completed
+ * the Course itself
+ */
+void evaluateAvailabilityMatrix(AvailabilityMatrix *matrixPtr) {
+
+	// checking for NULL pointer argument
+	if (matrixPtr == NULL) {
+		printf("\nCannot evaluate AvailabilityMatrix "
+				"with NULL AvailabilityMatrix "
+				"pointer argument\n");
+		return;
+	}
+
+	CourseBinaryTree *bt = matrixPtr->courseTreePtr;
+	unsigned int numCourseIds = matrixPtr->numCourseIds;
+	StudentBlock noStudents = {0};
+	for (unsigned int block = 0; block < matrixPtr->numBlocks; block++) {
+		StudentBlock *completed = matrixPtr->completed + (size_t) block * numCourseIds;
+		StudentBlock *available = matrixPtr->available + (size_t) block * numCourseIds;
+		StudentBlock rowMask;
+		blockRowMask(&rowMask, matrixPtr->numStudents, block);
+
+		for (unsigned int id = 0; id < numCourseIds; id++) {
+			Course *coursePtr = bt->coursesById[id];
+			if (coursePtr == NULL) {
+				available[id] = noStudents;
+				continue;
+			}
+			StudentBlock result = rowMask & ~completed[id];
+			PrereqExpr *exprPtr = coursePtr->prereqExpr;
+			if (exprPtr != NULL) {
+				unsigned int *clauseEnds = prereqClauseEnds(exprPtr);
+				unsigned int *courseIds = prereqCourseIds(exprPtr);
+				unsigned int term = 0;
+				for (unsigned int i = 0; i < exprPtr->numClauses; i++) {
+					StudentBlock fulfilled = noStudents;
+					for (; term < clauseEnds[i]; term++) {
+						fulfilled |= completed[courseIds[term]];
+					}
+					result &= fulfilled;
+				}
+			}
+			available[id] = result;
+		}
+	}
+	return;
+}
+
+/*
+ * freeAvailabilityMatrix() takes an AvailabilityMatrix
+ * pointer as an argument and frees its blocks and the
+ * AvailabilityMatrix
+ */
+void freeAvailabilityMatrix(AvailabilityMatrix *matrixPtr) {
+
+	if (matrixPtr == NULL) {
+		return;
+	}
+	free(matrixPtr->completed);
+	free(matrixPtr->available);
+	free(matrixPtr);
+	return;
+}
+
+/*
+ * isAvailableInMatrix() takes an AvailabilityMatrix
+ * pointer, a Student row, and a Course id as arguments
+ * and returns the row's bit of the Course's available
+ * block
+ */
+bool isAvailableInMatrix(AvailabilityMatrix *matrixPtr, unsigned int row, unsigned int courseId) {
+
+	if (matrixPtr == NULL || row >= matrixPtr->numStudents || courseId >= matrixPtr->numCourseIds) {
+		return false;
+	}
+	StudentBlock blockBits = matrixPtr->available[(size_t) (row / BLOCK_STUDENTS) * matrixPtr->numCourseIds + courseId];
+	return ( (blockBits[(row % BLOCK_STUDENTS) / 64] >> (row % 64)) & 1 ) != 0;
+}
+
+/*
+ * countAvailableRows() takes an AvailabilityMatrix
+ * pointer, a Course id, and a BitSet pointer of rows as
+ * arguments and adds up the population counts of the
+ * Course's available blocks ANDed with the rows
+ */
+unsigned int countAvailableRows(AvailabilityMatrix *matrixPtr, unsigned int courseId, BitSet *rowsPtr) {
+
+	if (matrixPtr == NULL || rowsPtr == NULL || courseId >= matrixPtr->numCourseIds) {
+		return 0;
+	}
+
+	unsigned int count = 0;
+	for (unsigned int w = 0; w < rowsPtr->numWords && w / BLOCK_WORDS < matrixPtr->numBlocks; w++) {
+		StudentBlock blockBits = matrixPtr->available[(size_t) (w / BLOCK_WORDS) * matrixPtr->numCourseIds + courseId];
+		count += __builtin_popcountll(blockBits[w % BLOCK_WORDS] & rowsPtr->words[w]);
+	}
+	return count;
+}
@@ -0,0 +1,127 @@
+/*
+ *
+ *	Header file for the AvailabilityMatrix ADT interface
+ *
+ *	An AvailabilityMatrix records, for every Student of a
+ *	CompletionStore and every Course id, whether the
+ *	Student can take the Course next - not completed, with
+ *	every prerequisite clause fulfilled. It answers the
+ *	question for the whole population in one pass instead
+ *	of one Student at a time (see availability.h for the
+ *	kept Availability of a single Student).
+ *
+ *	Students are taken in blocks of BLOCK_STUDENTS rows.
+ *	For each block, the completed Courses are laid out
+ *	as one StudentBlock per Course id - bit r of the
+ *	block for Course id is set if row r of the block has
+ *	completed the Course. A compiled prerequisite
+ *	expression (see prereqExpr.h) is then evaluated for
+ *	all of a block's Students at once: the blocks of each
+ *	clause's Courses are ORed, the clauses are ANDed,
+ *	and the Course's own completed block is masked out.
+ *
+ *	StudentBlock is a GCC vector type, so each AND and OR
+ *	is done with SIMD instructions - four 64-bit words at
+ *	a time with AVX2, or two pairs with SSE2 - without
+ *	any intrinsics or extra compiler flags.
+ *
+ *	Every block's completed and available rows for all
+ *	Course ids are next to each other, so evaluating a
+ *	block reads and writes one contiguous slice.
+ *
+ */
+
+#ifndef AVAILABILITYMATRIX_H
+#define AVAILABILITYMATRIX_H
+
+#include <stdint.h>
+#include "courseBT.h"
+#include "completionStore.h"
+#include "bitSet.h"
+
+// number of Students evaluated together
+#define BLOCK_STUDENTS 256
+
+// one bit per Student of a block
+typedef uint64_t StudentBlock __attribute__ ((vector_size (BLOCK_STUDENTS / 8)));
+
+// struct for the available Courses of every Student
+//
+// the block for block b and Course id is at
+// b * numCourseIds + id in completed and in available -
+// rows past numStudents are never set
+typedef struct availabilityMatrix {
+	CourseBinaryTree *courseTreePtr;
+	unsigned int numStudents;
+	unsigned int numBlocks;
+	unsigned int numCourseIds;
+	StudentBlock *completed;
+	StudentBlock *available;
+} AvailabilityMatrix;
+
+
+// AvailabilityMatrix interface
+
+/*
+ * lays out the completed Courses of every
+ * Student of the CompletionStore in blocks,
+ * evaluates the available Courses, and
+ * returns a pointer to the new
+ * AvailabilityMatrix
+ *
+ * storePtr - pointer to a built
+ * CompletionStore
+ *
+ * courseTreePtr - pointer to the
+ * CourseBinaryTree of every Course
+ */
+AvailabilityMatrix* buildAvailabilityMatrix(CompletionStore* storePtr, CourseBinaryTree* courseTreePtr);
+
+/*
+ * evaluates every Course's prerequisites
+ * for every block of Students again,
+ * filling the available blocks
+ *
+ * matrixPtr - pointer to the
+ * AvailabilityMatrix
+ */
+void evaluateAvailabilityMatrix(AvailabilityMatrix* matrixPtr);
+
+/*
+ * frees an AvailabilityMatrix and its
+ * blocks
+ *
+ * matrixPtr - pointer to the
+ * AvailabilityMatrix to free
+ */
+void freeAvailabilityMatrix(AvailabilityMatrix* matrixPtr);
+
+/*
+ * returns true if the Student of the row
+ * can take the Course next
+ *
+ * matrixPtr - pointer to the
+ * AvailabilityMatrix
+ *
+ * row - the Student's CompletionStore row
+ *
+ * courseId - id of the Course
+ */
+bool isAvailableInMatrix(AvailabilityMatrix* matrixPtr, unsigned int row, unsigned int courseId);
+
+/*
+ * returns the number of Students with a row
+ * in the BitSet who can take the Course next
+ *
+ * matrixPtr - pointer to the
+ * AvailabilityMatrix
+ *
+ * courseId - id of the Course
+ *
+ * rowsPtr - pointer to a BitSet of rows,
+ * such as a Degree column of the
+ * CompletionStore
+ */
+unsigned int countAvailableRows(AvailabilityMatrix* matrixPtr, unsigned int courseId, BitSet* rowsPtr);
+
+#endif
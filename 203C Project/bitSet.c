@@ -0,0 +1,389 @@
+/*
+ *
+ *	C source file containing the implementation of
+ *	the BitSet ADT
+ *
+ *	Each BitSet keeps its bits in 64-bit words that
+ *	are allocated in whole blocks of BITSET_BLOCK_WORDS
+ *	words. The counting kernels below load one block
+ *	at a time as a vector (GCC/Clang vector extensions)
+ *	so that AND and population count run on every
+ *	word of the block at once.
+ *
+ *	Go to header file for more information
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bitSet.h"
+
+// one block of words handled as a single vector
+typedef uint64_t BitBlock __attribute__((vector_size(BITSET_BLOCK_WORDS * 8), may_alias));
+
+/*
+ * allocateWords() takes a number of words as an
+ * argument and returns a block aligned, zeroed
+ * array of that many words
+ *
+ * numWords is always a whole number of blocks
+ */
+uint64_t* allocateWords(unsigned int numWords) {
+
+	uint64_t *words = (uint64_t*) aligned_alloc(sizeof(BitBlock), numWords * sizeof(uint64_t));
+	if (words != NULL) {
+		memset(words, 0, numWords * sizeof(uint64_t));
+	}
+	return words;
+}
+
+/*
+ * wordsForBits() returns the number of words
+ * needed to hold numBits bits, rounded up to a
+ * whole number of blocks (and at least one block)
+ */
+unsigned int wordsForBits(unsigned int numBits) {
+
+	unsigned int numBlocks = (numBits + BITSET_BLOCK_BITS - 1) / BITSET_BLOCK_BITS;
+	if (numBlocks == 0) {
+		numBlocks = 1;
+	}
+	return numBlocks * BITSET_BLOCK_WORDS;
+}
+
+/*
+ * initBitSet() takes the number of bits the BitSet
+ * needs to hold as an argument
+ *
+ * initBitSet() allocates heap space for the BitSet
+ * and for enough whole blocks of words to hold
+ * numBits bits, all cleared
+ *
+ * initBitSet() returns a pointer to the new BitSet
+ */
+BitSet* initBitSet(unsigned int numBits) {
+
+	// allocating heap space
+	BitSet *bitSetPtr = (BitSet*) malloc(sizeof(BitSet));
+	// filling in data members
+	bitSetPtr->numWords = wordsForBits(numBits);
+	bitSetPtr->words = allocateWords(bitSetPtr->numWords);
+	return bitSetPtr;
+}
+
+/*
+ * freeBitSet() takes a BitSet pointer as an
+ * argument and frees the BitSet's words and
+ * the BitSet itself
+ */
+void freeBitSet(BitSet *bitSetPtr) {
+
+	if (bitSetPtr == NULL) {
+		return;
+	}
+	free(bitSetPtr->words);
+	bitSetPtr->words = NULL;
+	free(bitSetPtr);
+	return;
+}
+
+/*
+ * growBitSet() takes a BitSet pointer and the index
+ * of a bit as arguments
+ *
+ * growBitSet() at least doubles the BitSet's number
+ * of words until the bit fits, copying the old words
+ * into the new (still block aligned) words
+ */
+void growBitSet(BitSet *bitSetPtr, unsigned int bit) {
+
+	unsigned int newNumWords = bitSetPtr->numWords * 2;
+	unsigned int numWordsNeeded = wordsForBits(bit + 1);
+	if (newNumWords < numWordsNeeded) {
+		newNumWords = numWordsNeeded;
+	}
+	uint64_t *newWords = allocateWords(newNumWords);
+	memcpy(newWords, bitSetPtr->words, bitSetPtr->numWords * sizeof(uint64_t));
+	free(bitSetPtr->words);
+	bitSetPtr->words = newWords;
+	bitSetPtr->numWords = newNumWords;
+	return;
+}
+
+/*
+ * setBit() takes a BitSet pointer and the index of
+ * a bit as arguments
+ *
+ * setBit() grows the BitSet if needed and sets
+ * the bit
+ */
+void setBit(BitSet *bitSetPtr, unsigned int bit) {
+
+	// checking for NULL pointer argument
+	if (bitSetPtr == NULL) {
+		printf("\nCannot set bit %u with NULL "
+				"BitSet pointer "
+				"argument\n", bit);
+		return;
+	}
+
+	if ( (bit / 64) >= bitSetPtr->numWords ) {
+		growBitSet(bitSetPtr, bit);
+	}
+	bitSetPtr->words[bit / 64] |= ( (uint64_t) 1 << (bit % 64) );
+	return;
+}
+
+/*
+ * clearBit() takes a BitSet pointer and the index
+ * of a bit as arguments
+ *
+ * clearBit() clears the bit - bits past the size
+ * of the BitSet are already clear
+ */
+void clearBit(BitSet *bitSetPtr, unsigned int bit) {
+
+	// checking for NULL pointer argument
+	if (bitSetPtr == NULL) {
+		printf("\nCannot clear bit %u with NULL "
+				"BitSet pointer "
+				"argument\n", bit);
+		return;
+	}
+
+	if ( (bit / 64) < bitSetPtr->numWords ) {
+		bitSetPtr->words[bit / 64] &= ~( (uint64_t) 1 << (bit % 64) );
+	}
+	return;
+}
+
+/*
+ * testBit() takes a BitSet pointer and the index
+ * of a bit as arguments
+ *
+ * testBit() returns true if the bit is set and
+ * false if it is not set or is past the size
+ * of the BitSet
+ */
+bool testBit(BitSet *bitSetPtr, unsigned int bit) {
+
+	if (bitSetPtr == NULL || (bit / 64) >= bitSetPtr->numWords) {
+		return false;
+	}
+	return ( (bitSetPtr->words[bit / 64] >> (bit % 64)) & 1 ) != 0;
+}
+
+/*
+ * clearAllBits() takes a BitSet pointer as an
+ * argument and clears every one of its words
+ */
+void clearAllBits(BitSet *bitSetPtr) {
+
+	// checking for NULL pointer argument
+	if (bitSetPtr == NULL) {
+		printf("\nCannot clear BitSet with NULL "
+				"BitSet pointer "
+				"argument\n");
+		return;
+	}
+
+	memset(bitSetPtr->words, 0, bitSetPtr->numWords * sizeof(uint64_t));
+	return;
+}
+
+/*
+ * addBlockCounts() takes a block of words and adds
+ * the number of set bits in each word of the block
+ * to the matching word of counts, counting all words
+ * at once with the standard shift-and-mask population
+ * count
+ *
+ * blocks are passed by pointer so that no vector is
+ * passed or returned by value
+ */
+static inline void addBlockCounts(BitBlock *counts, const BitBlock *blockPtr) {
+
+	BitBlock block = *blockPtr;
+	block = block - ( (block >> 1) & 0x5555555555555555ULL );
+	block = (block & 0x3333333333333333ULL) + ( (block >> 2) & 0x3333333333333333ULL );
+	block = (block + (block >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+	*counts += (block * 0x0101010101010101ULL) >> 56;
+	return;
+}
+
+/*
+ * sumBlock() adds up the words of a block of
+ * per-word bit counts
+ */
+static inline unsigned int sumBlock(const BitBlock *countsPtr) {
+
+	unsigned int total = 0;
+	for (int i = 0; i < BITSET_BLOCK_WORDS; i++) {
+		total += (unsigned int) (*countsPtr)[i];
+	}
+	return total;
+}
+
+/*
+ * countBits() takes a BitSet pointer as an argument
+ *
+ * countBits() counts the BitSet's set bits one
+ * block at a time, accumulating per-word counts in
+ * a block and only adding them up at the end
+ *
+ * countBits() returns the number of set bits
+ */
+unsigned int countBits(BitSet *bitSetPtr) {
+
+	if (bitSetPtr == NULL) {
+		return 0;
+	}
+
+	BitBlock *blocks = (BitBlock*) bitSetPtr->words;
+	unsigned int numBlocks = bitSetPtr->numWords / BITSET_BLOCK_WORDS;
+	BitBlock counts = { 0 };
+	for (unsigned int i = 0; i < numBlocks; i++) {
+		addBlockCounts(&counts, blocks + i);
+	}
+	return sumBlock(&counts);
+}
+
+/*
+ * countBitsInIntersection() takes two BitSet pointers
+ * as arguments
+ *
+ * countBitsInIntersection() ANDs the two BitSets one
+ * block at a time and counts the bits of each result
+ * block without storing the intersection anywhere
+ *
+ * only the blocks both BitSets have are checked -
+ * bits past the size of the smaller BitSet are
+ * clear in it
+ *
+ * countBitsInIntersection() returns the number of
+ * bits set in both BitSets
+ */
+unsigned int countBitsInIntersection(BitSet *firstPtr, BitSet *secondPtr) {
+
+	if (firstPtr == NULL || secondPtr == NULL) {
+		return 0;
+	}
+
+	BitBlock *firstBlocks = (BitBlock*) firstPtr->words;
+	BitBlock *secondBlocks = (BitBlock*) secondPtr->words;
+	unsigned int numWords = firstPtr->numWords;
+	if (secondPtr->numWords < numWords) {
+		numWords = secondPtr->numWords;
+	}
+	unsigned int numBlocks = numWords / BITSET_BLOCK_WORDS;
+	BitBlock counts = { 0 };
+	for (unsigned int i = 0; i < numBlocks; i++) {
+		BitBlock both = firstBlocks[i] & secondBlocks[i];
+		addBlockCounts(&counts, &both);
+	}
+	return sumBlock(&counts);
+}
+
+/*
+ * unionBits() takes a target BitSet pointer and a
+ * source BitSet pointer as arguments
+ *
+ * unionBits() grows the target to the size of the
+ * source if it is smaller and then ORs the source
+ * into the target one block at a time
+ */
+void unionBits(BitSet *targetPtr, BitSet *sourcePtr) {
+
+	// checking for NULL pointer arguments
+	if (targetPtr == NULL || sourcePtr == NULL) {
+		printf("\nCannot take the union of BitSets "
+				"with NULL BitSet pointer "
+				"argument\n");
+		return;
+	}
+
+	if (targetPtr->numWords < sourcePtr->numWords) {
+		growBitSet(targetPtr, sourcePtr->numWords * 64 - 1);
+	}
+	BitBlock *targetBlocks = (BitBlock*) targetPtr->words;
+	BitBlock *sourceBlocks = (BitBlock*) sourcePtr->words;
+	unsigned int numBlocks = sourcePtr->numWords / BITSET_BLOCK_WORDS;
+	for (unsigned int i = 0; i < numBlocks; i++) {
+		targetBlocks[i] |= sourceBlocks[i];
+	}
+	return;
+}
+
+/*
+ * intersectsBlocks() takes a BitSet pointer, an array of
+ * block indices, a block aligned array of mask words,
+ * and a number of mask blocks as arguments
+ *
+ * intersectsBlocks() ANDs each block of the mask with
+ * the BitSet's block at the index given for it and
+ * returns true as soon as a result is nonzero
+ *
+ * blocks past the size of the BitSet are clear in it
+ * and are not checked
+ *
+ * intersectsBlocks() returns true if any bit of the
+ * mask is set in the BitSet
+ */
+bool intersectsBlocks(BitSet *bitSetPtr, unsigned int *blockIndices, uint64_t *maskWords, unsigned int numBlocks) {
+
+	if (bitSetPtr == NULL || blockIndices == NULL || maskWords == NULL) {
+		return false;
+	}
+
+	unsigned int numSetBlocks = bitSetPtr->numWords / BITSET_BLOCK_WORDS;
+	BitBlock *setBlocks = (BitBlock*) bitSetPtr->words;
+	BitBlock *maskBlocks = (BitBlock*) maskWords;
+	for (unsigned int i = 0; i < numBlocks; i++) {
+		if (blockIndices[i] >= numSetBlocks) {
+			continue;
+		}
+		BitBlock both = setBlocks[blockIndices[i]] & maskBlocks[i];
+		uint64_t anyWord = 0;
+		for (unsigned int w = 0; w < BITSET_BLOCK_WORDS; w++) {
+			anyWord |= both[w];
+		}
+		if (anyWord != 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/*
+ * countMissingBlocks() takes a BitSet pointer, an array
+ * of block indices, a block aligned array of mask
+ * words, and a number of mask blocks as arguments
+ *
+ * countMissingBlocks() ANDs each block of the mask with
+ * the complement of the BitSet's block at the index
+ * given for it and counts the bits of the results -
+ * a block past the size of the BitSet is clear in it,
+ * so all of the mask block's bits are counted
+ *
+ * countMissingBlocks() returns the number of bits of
+ * the mask not set in the BitSet
+ */
+unsigned int countMissingBlocks(BitSet *bitSetPtr, unsigned int *blockIndices, uint64_t *maskWords, unsigned int numBlocks) {
+
+	if (bitSetPtr == NULL || blockIndices == NULL || maskWords == NULL) {
+		return 0;
+	}
+
+	unsigned int numSetBlocks = bitSetPtr->numWords / BITSET_BLOCK_WORDS;
+	BitBlock *setBlocks = (BitBlock*) bitSetPtr->words;
+	BitBlock *maskBlocks = (BitBlock*) maskWords;
+	BitBlock noBits = { 0 };
+	BitBlock counts = { 0 };
+	for (unsigned int i = 0; i < numBlocks; i++) {
+		BitBlock setBlock = (blockIndices[i] < numSetBlocks) ? setBlocks[blockIndices[i]] : noBits;
+		BitBlock missing = maskBlocks[i] & ~setBlock;
+		addBlockCounts(&counts, &missing);
+	}
+	return sumBlock(&counts);
+}
@@ -0,0 +1,161 @@
+/*
+ *
+ *	Header file for the BitSet ADT interface
+ *
+ *	A BitSet is a bit-packed set of unsigned integers.
+ *	In terms of this program, the integers are most
+ *	often Course ids (see Course in course.h) or the
+ *	row numbers of Students in the CompletionStore.
+ *
+ *	Bits are stored in 64-bit words that are grouped
+ *	into blocks of BITSET_BLOCK_WORDS words. The
+ *	counting, intersection, and union kernels work on a
+ *	whole block at a time with the compiler's vector
+ *	extensions, so every BitSet always holds a whole
+ *	number of blocks.
+ *
+ *	A BitSet grows as needed when a bit past its
+ *	current size is set. Bits past the current size
+ *	read as zero.
+ *
+ */
+
+#ifndef BITSET_H
+#define BITSET_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// number of 64-bit words in one block
+#define BITSET_BLOCK_WORDS 4
+// number of bits in one block
+#define BITSET_BLOCK_BITS (BITSET_BLOCK_WORDS * 64)
+
+// struct for a BitSet
+typedef struct bitSet {
+	unsigned int numWords;
+	uint64_t *words;
+} BitSet;
+
+
+// BitSet interface
+
+/*
+ * allocates heap space for a BitSet with room
+ * for at least numBits bits, all cleared, and
+ * returns a pointer to the new BitSet
+ *
+ * numBits - number of bits the BitSet should
+ * hold before it has to grow
+ */
+BitSet* initBitSet(unsigned int numBits);
+
+/*
+ * frees a BitSet and its words
+ *
+ * bitSetPtr - pointer to the BitSet to free
+ */
+void freeBitSet(BitSet* bitSetPtr);
+
+/*
+ * sets a bit in the BitSet, growing the
+ * BitSet if the bit is past its current size
+ *
+ * bitSetPtr - pointer to the BitSet
+ *
+ * bit - index of the bit to set
+ */
+void setBit(BitSet* bitSetPtr, unsigned int bit);
+
+/*
+ * clears a bit in the BitSet
+ *
+ * bitSetPtr - pointer to the BitSet
+ *
+ * bit - index of the bit to clear
+ */
+void clearBit(BitSet* bitSetPtr, unsigned int bit);
+
+/*
+ * returns true if the bit is set in the BitSet
+ * and false otherwise (including bits past the
+ * BitSet's current size)
+ *
+ * bitSetPtr - pointer to the BitSet
+ *
+ * bit - index of the bit to test
+ */
+bool testBit(BitSet* bitSetPtr, unsigned int bit);
+
+/*
+ * clears every bit in the BitSet
+ *
+ * bitSetPtr - pointer to the BitSet
+ */
+void clearAllBits(BitSet* bitSetPtr);
+
+/*
+ * returns the number of set bits in the BitSet
+ *
+ * bitSetPtr - pointer to the BitSet to count
+ */
+unsigned int countBits(BitSet* bitSetPtr);
+
+/*
+ * returns the number of bits set in both
+ * BitSets without building their intersection
+ *
+ * firstPtr - pointer to the first BitSet
+ *
+ * secondPtr - pointer to the second BitSet
+ */
+unsigned int countBitsInIntersection(BitSet* firstPtr, BitSet* secondPtr);
+
+/*
+ * sets every bit of the source BitSet in the
+ * target BitSet, growing the target if needed
+ *
+ * targetPtr - pointer to the BitSet to add to
+ *
+ * sourcePtr - pointer to the BitSet whose bits
+ * are added
+ */
+void unionBits(BitSet* targetPtr, BitSet* sourcePtr);
+
+/*
+ * returns true if any bit of a mask is set in
+ * the BitSet - the mask is made of whole
+ * blocks, each standing for the block of the
+ * BitSet at the index given for it
+ *
+ * bitSetPtr - pointer to the BitSet
+ *
+ * blockIndices - array of numBlocks indices of
+ * the BitSet blocks the mask covers
+ *
+ * maskWords - block aligned array of
+ * numBlocks blocks of mask words
+ *
+ * numBlocks - number of blocks in the mask
+ */
+bool intersectsBlocks(BitSet* bitSetPtr, unsigned int* blockIndices, uint64_t* maskWords, unsigned int numBlocks);
+
+/*
+ * returns the number of bits of a mask that
+ * are not set in the BitSet - the mask is made
+ * of whole blocks, each standing for the block
+ * of the BitSet at the index given for it
+ *
+ * bitSetPtr - pointer to the BitSet
+ *
+ * blockIndices - array of numBlocks indices of
+ * the BitSet blocks the mask covers
+ *
+ * maskWords - block aligned array of
+ * numBlocks blocks of mask words
+ *
+ * numBlocks - number of blocks in the mask
+ */
+unsigned int countMissingBlocks(BitSet* bitSetPtr, unsigned int* blockIndices, uint64_t* maskWords, unsigned int numBlocks);
+
+#endif
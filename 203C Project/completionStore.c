@@ -0,0 +1,279 @@
+/*
+ *
+ *	C source file containing the implementation of
+ *	the CompletionStore ADT
+ *
+ *	The CompletionStore keeps one BitSet column per
+ *	Course (indexed by Course id) and one per Degree
+ *	name, with one bit per Student row. Columns are
+ *	only allocated for Courses that at least one
+ *	Student has completed.
+ *
+ *	Go to header file for more information
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "completionStore.h"
+
+/*
+ * initCompletionStore() allocates heap space for a
+ * CompletionStore and initializes it as empty and
+ * not yet built
+ *
+ * initCompletionStore() returns a pointer to the
+ * new CompletionStore
+ */
+CompletionStore* initCompletionStore() {
+
+	// allocating heap space
+	CompletionStore *storePtr = (CompletionStore*) malloc(sizeof(CompletionStore));
+	// filling in data members
+	storePtr->built = false;
+	storePtr->studentTreeVersion = 0;
+	storePtr->numStudents = 0;
+	storePtr->students = NULL;
+	storePtr->numCourseColumns = 0;
+	storePtr->courseColumns = NULL;
+	storePtr->numDegrees = 0;
+	storePtr->degreeNames = NULL;
+	storePtr->degreeColumns = NULL;
+	return storePtr;
+}
+
+/*
+ * clearCompletionStore() takes a CompletionStore
+ * pointer as an argument and frees all of its rows
+ * and columns, leaving it empty
+ */
+void clearCompletionStore(CompletionStore *storePtr) {
+
+	for (unsigned int i = 0; i < storePtr->numCourseColumns; i++) {
+		freeBitSet(storePtr->courseColumns[i]);
+	}
+	for (unsigned int i = 0; i < storePtr->numDegrees; i++) {
+		freeBitSet(storePtr->degreeColumns[i]);
+	}
+	free(storePtr->students);
+	free(storePtr->courseColumns);
+	free(storePtr->degreeNames);
+	free(storePtr->degreeColumns);
+	storePtr->students = NULL;
+	storePtr->courseColumns = NULL;
+	storePtr->degreeNames = NULL;
+	storePtr->degreeColumns = NULL;
+	storePtr->numStudents = 0;
+	storePtr->numCourseColumns = 0;
+	storePtr->numDegrees = 0;
+	storePtr->built = false;
+	return;
+}
+
+/*
+ * freeCompletionStore() takes a CompletionStore pointer
+ * as an argument and frees its rows and columns (see
+ * clearCompletionStore()) and the CompletionStore - the
+ * Students and Degree names belong to the trees
+ */
+void freeCompletionStore(CompletionStore *storePtr) {
+
+	if (storePtr == NULL) {
+		return;
+	}
+	clearCompletionStore(storePtr);
+	free(storePtr);
+	return;
+}
+
+/*
+ * traverseAndAddRows() takes a StudentBTNode pointer
+ * and a CompletionStore pointer as arguments
+ *
+ * traverseAndAddRows() traverses the tree/subtree in
+ * order and gives every Student the next row of the
+ * CompletionStore
+ */
+void traverseAndAddRows(StudentBTNode *nodePtr, CompletionStore *storePtr) {
+
+	// passed leaf node
+	if (nodePtr == NULL) {
+		return;
+	}
+
+	traverseAndAddRows(nodePtr->left, storePtr);
+	storePtr->students[storePtr->numStudents] = nodePtr->studentPtr;
+	storePtr->numStudents++;
+	traverseAndAddRows(nodePtr->right, storePtr);
+	return;
+}
+
+/*
+ * findOrAddDegreeColumn() takes a CompletionStore
+ * pointer and a Degree name as arguments
+ *
+ * findOrAddDegreeColumn() returns the index of the
+ * Degree's column, adding a new column if no Student
+ * seen so far is in the Degree program
+ *
+ * degreeCapacity points to the current capacity of
+ * the degree columns, doubled as necessary
+ */
+unsigned int findOrAddDegreeColumn(CompletionStore *storePtr, char *degreeName, unsigned int *degreeCapacity) {
+
+	for (unsigned int i = 0; i < storePtr->numDegrees; i++) {
+		if ( storePtr->degreeNames[i] == degreeName || strcmp(storePtr->degreeNames[i], degreeName) == 0 ) {
+			return i;
+		}
+	}
+	if (storePtr->numDegrees == *degreeCapacity) {
+		*degreeCapacity *= 2;
+		storePtr->degreeNames = (char**) realloc(storePtr->degreeNames, (*degreeCapacity) * sizeof(char*));
+		storePtr->degreeColumns = (BitSet**) realloc(storePtr->degreeColumns, (*degreeCapacity) * sizeof(BitSet*));
+	}
+	storePtr->degreeNames[storePtr->numDegrees] = degreeName;
+	storePtr->degreeColumns[storePtr->numDegrees] = initBitSet(storePtr->numStudents);
+	storePtr->numDegrees++;
+	return storePtr->numDegrees - 1;
+}
+
+/*
+ * refreshCompletionStore() takes a CompletionStore
+ * pointer, a StudentBinaryTree pointer and a
+ * CourseBinaryTree pointer as arguments
+ *
+ * if the CompletionStore was built from the current
+ * version of the StudentBinaryTree, nothing is done
+ *
+ * otherwise, the old rows and columns are freed,
+ * every Student is given a row in alphabetical
+ * order, and each Student's completed Courses and
+ * Degree name are set in the matching columns
+ */
+void refreshCompletionStore(CompletionStore *storePtr, StudentBinaryTree *studentTreePtr, CourseBinaryTree *courseTreePtr) {
+
+	// checking for NULL pointer arguments
+	if (storePtr == NULL) {
+		printf("\nCannot refresh CompletionStore "
+				"with NULL CompletionStore "
+				"pointer argument\n");
+		return;
+	}
+	if (studentTreePtr == NULL) {
+		printf("\nCannot refresh CompletionStore "
+				"with NULL StudentBinaryTree "
+				"pointer argument\n");
+		return;
+	}
+	if (courseTreePtr == NULL) {
+		printf("\nCannot refresh CompletionStore "
+				"with NULL CourseBinaryTree "
+				"pointer argument\n");
+		return;
+	}
+
+	// nothing has changed since the last build
+	if (storePtr->built && storePtr->studentTreeVersion == studentTreePtr->version) {
+		return;
+	}
+	clearCompletionStore(storePtr);
+
+	// giving every Student a row
+	storePtr->students = (Student**) calloc(studentTreePtr->size + 1, sizeof(Student*));
+	traverseAndAddRows(studentTreePtr->root, storePtr);
+
+	// one (initially missing) column per Course id
+	storePtr->numCourseColumns = courseTreePtr->numCourseIds;
+	storePtr->courseColumns = (BitSet**) calloc(storePtr->numCourseColumns + 1, sizeof(BitSet*));
+	unsigned int degreeCapacity = 10;
+	storePtr->degreeNames = (char**) calloc(degreeCapacity, sizeof(char*));
+	storePtr->degreeColumns = (BitSet**) calloc(degreeCapacity, sizeof(BitSet*));
+
+	// filling in the columns row by row
+	for (unsigned int row = 0; row < storePtr->numStudents; row++) {
+		Student *stuPtr = storePtr->students[row];
+		if (stuPtr->degree != NULL) {
+			unsigned int degreeIndex = findOrAddDegreeColumn(storePtr, stuPtr->degree, &degreeCapacity);
+			setBit(storePtr->degreeColumns[degreeIndex], row);
+		}
+		Vector *completedPtr = stuPtr->completedCourses;
+		for (unsigned int i = 0; i < completedPtr->numElements; i++) {
+			unsigned int courseId = completedPtr->elements[i].course->id;
+			if (courseId >= storePtr->numCourseColumns) {
+				continue;
+			}
+			if (storePtr->courseColumns[courseId] == NULL) {
+				storePtr->courseColumns[courseId] = initBitSet(storePtr->numStudents);
+			}
+			setBit(storePtr->courseColumns[courseId], row);
+		}
+	}
+
+	storePtr->studentTreeVersion = studentTreePtr->version;
+	storePtr->built = true;
+	return;
+}
+
+/*
+ * findCourseColumn() takes a CompletionStore pointer
+ * and a Course pointer as arguments and returns the
+ * Course's column, or NULL if no Student has
+ * completed the Course
+ */
+BitSet* findCourseColumn(CompletionStore *storePtr, Course *coursePtr) {
+
+	if (storePtr == NULL || coursePtr == NULL || coursePtr->id >= storePtr->numCourseColumns) {
+		return NULL;
+	}
+	return storePtr->courseColumns[coursePtr->id];
+}
+
+/*
+ * countCourseCompletions() takes a CompletionStore
+ * pointer and a Course pointer as arguments and
+ * returns the population count of the Course's column
+ */
+unsigned int countCourseCompletions(CompletionStore *storePtr, Course *coursePtr) {
+
+	return countBits( findCourseColumn(storePtr, coursePtr) );
+}
+
+/*
+ * countJointCourseCompletions() takes a CompletionStore
+ * pointer and two Course pointers as arguments and
+ * returns the population count of the intersection
+ * of the two Courses' columns
+ */
+unsigned int countJointCourseCompletions(CompletionStore *storePtr, Course *firstCoursePtr, Course *secondCoursePtr) {
+
+	return countBitsInIntersection( findCourseColumn(storePtr, firstCoursePtr), findCourseColumn(storePtr, secondCoursePtr) );
+}
+
+/*
+ * countDegreeStudents() takes a CompletionStore pointer
+ * and the index of a Degree column as arguments and
+ * returns the population count of the Degree's column
+ */
+unsigned int countDegreeStudents(CompletionStore *storePtr, unsigned int degreeIndex) {
+
+	if (storePtr == NULL || degreeIndex >= storePtr->numDegrees) {
+		return 0;
+	}
+	return countBits(storePtr->degreeColumns[degreeIndex]);
+}
+
+/*
+ * countDegreeCourseCompletions() takes a CompletionStore
+ * pointer, the index of a Degree column, and a Course
+ * pointer as arguments and returns the population
+ * count of the intersection of the Degree's column
+ * and the Course's column
+ */
+unsigned int countDegreeCourseCompletions(CompletionStore *storePtr, unsigned int degreeIndex, Course *coursePtr) {
+
+	if (storePtr == NULL || degreeIndex >= storePtr->numDegrees) {
+		return 0;
+	}
+	return countBitsInIntersection(storePtr->degreeColumns[degreeIndex], findCourseColumn(storePtr, coursePtr));
+}
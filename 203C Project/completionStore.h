@@ -0,0 +1,134 @@
+/*
+ *
+ *	Header file for the CompletionStore ADT interface
+ *
+ *	The CompletionStore is a column-oriented copy of
+ *	every Student's completed Courses, built from the
+ *	StudentBinaryTree for population-level questions
+ *	such as "how many Students have completed each
+ *	Course" or "what share of each Degree program's
+ *	Students have completed MATH 162".
+ *
+ *	Every Student on the tree is given a row number
+ *	(in alphabetical order). For each Course, a
+ *	BitSet column indexed by row records which
+ *	Students have completed the Course - the column
+ *	is found by Course id. For each Degree name held
+ *	by a Student, another BitSet column records
+ *	which Students are in that Degree program.
+ *
+ *	Aggregates then become population counts of a
+ *	column, or of the intersection of two columns,
+ *	instead of walks of the StudentBinaryTree.
+ *
+ *	The CompletionStore remembers the version of the
+ *	StudentBinaryTree it was built from and is only
+ *	rebuilt after the tree changes.
+ *
+ */
+
+#ifndef COMPLETIONSTORE_H
+#define COMPLETIONSTORE_H
+
+#include "bitSet.h"
+#include "courseBT.h"
+#include "studentBT.h"
+
+// struct for the column store of completed Courses
+typedef struct completionStore {
+	bool built;
+	unsigned int studentTreeVersion;
+	unsigned int numStudents;
+	Student **students;
+	unsigned int numCourseColumns;
+	BitSet **courseColumns;
+	unsigned int numDegrees;
+	char **degreeNames;
+	BitSet **degreeColumns;
+} CompletionStore;
+
+
+// CompletionStore interface
+
+/*
+ * allocates heap space for an empty
+ * CompletionStore and returns a pointer
+ * to it - the CompletionStore is built
+ * by refreshCompletionStore()
+ */
+CompletionStore* initCompletionStore();
+
+/*
+ * frees a CompletionStore and all of its
+ * rows and columns
+ *
+ * storePtr - pointer to the CompletionStore
+ * to free
+ */
+void freeCompletionStore(CompletionStore* storePtr);
+
+/*
+ * (re)builds the CompletionStore's rows and
+ * columns from the StudentBinaryTree if the
+ * CompletionStore has not been built yet or
+ * the tree has changed since it was built
+ *
+ * storePtr - pointer to the CompletionStore
+ *
+ * studentTreePtr - pointer to the
+ * StudentBinaryTree the rows come from
+ *
+ * courseTreePtr - pointer to the
+ * CourseBinaryTree that hands out the
+ * Course ids used to find columns
+ */
+void refreshCompletionStore(CompletionStore* storePtr, StudentBinaryTree* studentTreePtr, CourseBinaryTree* courseTreePtr);
+
+/*
+ * returns the number of Students who have
+ * completed the given Course
+ *
+ * storePtr - pointer to the CompletionStore
+ *
+ * coursePtr - pointer to the Course
+ */
+unsigned int countCourseCompletions(CompletionStore* storePtr, Course* coursePtr);
+
+/*
+ * returns the number of Students who have
+ * completed both of the given Courses
+ *
+ * storePtr - pointer to the CompletionStore
+ *
+ * firstCoursePtr - pointer to the first Course
+ *
+ * secondCoursePtr - pointer to the second Course
+ */
+unsigned int countJointCourseCompletions(CompletionStore* storePtr, Course* firstCoursePtr, Course* secondCoursePtr);
+
+/*
+ * returns the number of Students in the
+ * Degree program with the given column index
+ *
+ * storePtr - pointer to the CompletionStore
+ *
+ * degreeIndex - index of the Degree column
+ * (0 to numDegrees - 1)
+ */
+unsigned int countDegreeStudents(CompletionStore* storePtr, unsigned int degreeIndex);
+
+/*
+ * returns the number of Students in the
+ * Degree program with the given column index
+ * who have completed the given Course
+ *
+ * storePtr - pointer to the CompletionStore
+ *
+ * degreeIndex - index of the Degree column
+ * (0 to numDegrees - 1)
+ *
+ * coursePtr - pointer to the Course
+ */
+unsigned int countDegreeCourseCompletions(CompletionStore* storePtr, unsigned int degreeIndex, Course* coursePtr);
+
+#endif
@@ -21,6 +21,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "course.h"
+#include "stringPool.h"
 
 
 /*
@@ -29,8 +30,9 @@
  * heap space for the Course 
  * *
  * initCourse() initializes the Course's name
- * with the string argument and initializes all 
- * other data members with NULL
+ * with the pooled copy of the string argument (see
+ * stringPool.h) and initializes all other data
+ * members with NULL
  * 
  * initCourse() returns a Course pointer to the
  * new Course
@@ -46,13 +48,20 @@ Course* initCourse(char* courseName) {
 	// allocating heap space
 	Course *coursePtr = (Course*) malloc(sizeof(Course));
 	// filling in data members
-	coursePtr->name = courseName;
+	coursePtr->id = 0;
+	coursePtr->name = internString(courseName);
 	coursePtr->title = NULL;
 	coursePtr->depName = NULL;
 	coursePtr->firstDegree = NULL;
 	coursePtr->lastDegree = NULL;
 	coursePtr->firstPrereq = NULL;
 	coursePtr->lastPrereq = NULL;
+	coursePtr->prereqExpr = NULL;
+	coursePtr->prereqClosure = NULL;
+	coursePtr->closureState = CLOSURE_STALE;
+	coursePtr->dependents = NULL;
+	coursePtr->numDependents = 0;
+	coursePtr->dependentCapacity = 0;
 	return coursePtr;
 }
 
@@ -226,6 +235,10 @@ void appendPrereqToCourse(Course *coursePtr, char *prereqName) {
  *
  * clearCoursePrerequisites() clears the linked list
  * of prerequisite name strings
+ *
+ * the compiled prerequisites are left for
+ * compileCoursePrerequisites(), which also drops the
+ * Course's back-references from its old prerequisites
  */
 void clearCoursePrerequisites(Course* coursePtr) {
 
@@ -238,7 +251,110 @@ void clearCoursePrerequisites(Course* coursePtr) {
 	}
 
 	clearLinkedList( &(coursePtr->firstPrereq) );
+	coursePtr->lastPrereq = NULL;
+
+	return;
+}
+
+/*
+ * removePrerequisiteFromCourse() takes a Course pointer
+ * (parameter coursePtr) and a prerequisite name
+ * (parameter prereqName) as arguments
+ *
+ * removePrerequisiteFromCourse() removes every string
+ * of the Course's prerequisite list that is prereqName,
+ * and replaces a prerequisite group with prereqName by
+ * the rest of the group
+ *
+ * the compiled prerequisites are left as they are - the
+ * caller compiles them again (see
+ * compileCoursePrerequisites())
+ */
+void removePrerequisiteFromCourse(Course *coursePtr, char *prereqName) {
+
+	// checking for NULL pointer arguments
+	if (coursePtr == NULL || prereqName == NULL) {
+		printf("\nCannot remove a prerequisite from a "
+				"Course with NULL Course pointer "
+				"or prerequisite name "
+				"argument\n");
+		return;
+	}
+
+	LinkedListNode *prereqPtr = coursePtr->firstPrereq;
+	while (prereqPtr != NULL) {
+		if ( isPrereqGroup(prereqPtr->name) && prereqStringHasCourse(prereqPtr->name, prereqName) ) {
+			char *restOfGroup = removeFromPrereqGroup(prereqPtr->name, prereqName);
+			// an emptied group is removed below with 
+			// the plain prereqName strings
+			prereqPtr->name = (restOfGroup != NULL) ? internHeapString(restOfGroup) : internString(prereqName);
+		}
+		prereqPtr = prereqPtr->next;
+	}
+	removeFromLinkedList( &(coursePtr->firstPrereq), prereqName);
+
+	// finding the new end of the list
+	coursePtr->lastPrereq = coursePtr->firstPrereq;
+	while (coursePtr->lastPrereq != NULL && coursePtr->lastPrereq->next != NULL) {
+		coursePtr->lastPrereq = coursePtr->lastPrereq->next;
+	}
+	return;
+}
+
+/*
+ * addDependentToCourse() takes a Course pointer
+ * (parameter coursePtr) and a pointer to a Course that
+ * requires it (parameter dependentPtr) as arguments
+ *
+ * addDependentToCourse() appends the back-reference,
+ * doubling the capacity of the Course's dependents as
+ * necessary
+ */
+void addDependentToCourse(Course *coursePtr, Course *dependentPtr) {
+
+	// checking for NULL pointer arguments
+	if (coursePtr == NULL || dependentPtr == NULL) {
+		printf("\nCannot add a dependent to a Course "
+				"with NULL Course pointer "
+				"argument\n");
+		return;
+	}
+
+	if (coursePtr->numDependents == coursePtr->dependentCapacity) {
+		coursePtr->dependentCapacity = (coursePtr->dependentCapacity == 0) ? 4 : coursePtr->dependentCapacity * 2;
+		coursePtr->dependents = (Course**) realloc(coursePtr->dependents, coursePtr->dependentCapacity * sizeof(Course*));
+	}
+	coursePtr->dependents[coursePtr->numDependents] = dependentPtr;
+	coursePtr->numDependents++;
+	return;
+}
+
+/*
+ * removeDependentFromCourse() takes a Course pointer
+ * (parameter coursePtr) and a pointer to a Course that
+ * required it (parameter dependentPtr) as arguments
+ *
+ * removeDependentFromCourse() removes one back-reference
+ * to the dependent Course by moving the last one into
+ * its place - the order of dependents does not matter
+ */
+void removeDependentFromCourse(Course *coursePtr, Course *dependentPtr) {
+
+	// checking for NULL pointer arguments
+	if (coursePtr == NULL || dependentPtr == NULL) {
+		printf("\nCannot remove a dependent from a "
+				"Course with NULL Course pointer "
+				"argument\n");
+		return;
+	}
 
+	for (unsigned int i = 0; i < coursePtr->numDependents; i++) {
+		if (coursePtr->dependents[i] == dependentPtr) {
+			coursePtr->numDependents--;
+			coursePtr->dependents[i] = coursePtr->dependents[coursePtr->numDependents];
+			return;
+		}
+	}
 	return;
 }
 
@@ -305,7 +421,13 @@ void printPrerequisites(Course *coursePtr) {
  *
  * returns 0 if there is no match (false)
  * and returns 1 if the Course has the prerequisite 
- * string in its string LinkedList
+ * string in its string LinkedList, on its own or as
+ * one of the names of a prerequisite group
+ *
+ * the prerequisite strings are pooled (see
+ * stringPool.h), so one on its own is compared by
+ * pointer with the pooled copy of the string - only a
+ * group's names are compared character by character
  * 
  * checkCourseForPrerequisite() returns -1 for all
  * errors
@@ -328,11 +450,16 @@ int checkCourseForPrerequisite(Course *coursePtr, char *prerequisiteName) {
 
 	// checking that the Course has prerequisite
 	if (coursePtr->firstPrereq != NULL) {
+		// a string that is not pooled is no prerequisite's
+		char *pooledName = findInternedString(prerequisiteName);
+		if (pooledName == NULL) {
+			return 0;
+		}
 		LinkedListNode *tempPtr = coursePtr->firstPrereq;
 		
 		while (tempPtr != NULL) {
 
-			if ( strcmp(tempPtr->name, prerequisiteName) == 0 ){
+			if ( tempPtr->name == pooledName || ( isPrereqGroup(tempPtr->name) && prereqStringHasCourse(tempPtr->name, pooledName) ) ){
 				return 1;
 			}
 			tempPtr = tempPtr->next;
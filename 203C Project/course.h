@@ -26,15 +26,41 @@
  *	to, all degree programs it is apart of, and all of the course's
  *	prerequisites if provided through the use of strings and linked lists
  *	of strings
+ *
+ *	The prerequisite strings are also compiled into a PrereqExpr of
+ *	Course ids (see prereqExpr.h) by the CourseBinaryTree whenever
+ *	they change, and prerequisites are checked with the compiled
+ *	expression
  */
 
 #ifndef COURSE_H
 #define COURSE_H
 
+#include <stdbool.h>
 #include "stringLinkedList.h"
+#include "prereqExpr.h"
+#include "bitSet.h"
 
 // struct for Course
+//
+// id is a small, dense number handed out by the 
+// CourseBinaryTree when the Course is first inserted
+// it is used to index BitSets of Courses
+//
+// prereqExpr is the compiled form of the prerequisite
+// list - NULL when the Course has no prerequisites
+//
+// prereqClosure holds the ids of every Course that is
+// a prerequisite of the Course, directly or through
+// other prerequisites, and closureState tells whether
+// it is up to date (see prereqClosure.h)
+//
+// dependents are back-references to the Courses whose
+// compiled prerequisites have this Course, once for
+// each time they have it - they are kept by
+// compileCoursePrerequisites()
 typedef struct course {
+	unsigned int id;
 	char *name;
 	char *title;
 	char *depName;
@@ -42,8 +68,18 @@ typedef struct course {
 	LinkedListNode *lastDegree;
 	LinkedListNode *firstPrereq;
 	LinkedListNode *lastPrereq;
+	PrereqExpr *prereqExpr;
+	BitSet *prereqClosure;
+	unsigned char closureState;
+	struct course **dependents;
+	unsigned int numDependents;
+	unsigned int dependentCapacity;
 } Course;
 
+// states of a Course's prerequisite closure
+#define CLOSURE_STALE 0
+#define CLOSURE_CURRENT 1
+
 
 // Course ADT interface
 
@@ -51,6 +87,7 @@ typedef struct course {
 /*
  * initializes type Course with a Course name string argument,
  * allocates heap space for the Course and returns a Course pointer
+ * the Course's id is filled in by the CourseBinaryTree
  * 
  * courseName - string for the name of the Course to
  * be initialized
@@ -102,13 +139,53 @@ void appendPrereqToCourse(Course* coursePtr, char* prereqName);
 
 /*
  * clears the Course's list of prerequisite Courses and
- *  frees the used heap space
+ *  frees the used heap space - the compiled
+ *  prerequisites are freed when the Course is compiled
+ *  again (see compileCoursePrerequisites())
  *
  *  coursePtr - pointer to the Course to have prerequisites
  *  cleared from
  */
 void clearCoursePrerequisites(Course* coursePtr);
 
+/*
+ * removes a prerequisite Course name from the
+ * Course's list of prerequisites, on its own or
+ * from inside a prerequisite group - the
+ * compiled prerequisites are not changed
+ *
+ * coursePtr - pointer to the Course to remove
+ * the prerequisite from
+ *
+ * prereqName - name of the prerequisite to
+ * remove
+ */
+void removePrerequisiteFromCourse(Course* coursePtr, char* prereqName);
+
+/*
+ * adds a back-reference to a Course that has
+ * the given Course as a prerequisite
+ *
+ * coursePtr - pointer to the prerequisite
+ * Course
+ *
+ * dependentPtr - pointer to the Course that
+ * requires it
+ */
+void addDependentToCourse(Course* coursePtr, Course* dependentPtr);
+
+/*
+ * removes one back-reference to a Course that
+ * had the given Course as a prerequisite
+ *
+ * coursePtr - pointer to the prerequisite
+ * Course
+ *
+ * dependentPtr - pointer to the Course that
+ * required it
+ */
+void removeDependentFromCourse(Course* coursePtr, Course* dependentPtr);
+
 
 /* 
  * prints all of a given Course's prerequisite Course names
@@ -120,7 +197,8 @@ void printPrerequisites(Course* coursePtr);
 
 
 /*
- * checks a given Course for a prerequisite Course name
+ * checks a given Course for a prerequisite Course name,
+ * on its own or inside a prerequisite group,
  * returning 0 if the prerequisite is not found, 
  * returning 1 if the prerequisite does exist, and
  * returning -1 for errors
@@ -30,6 +30,7 @@
 #include <stdbool.h>
 #include "courseBT.h"
 #include "course.h"
+#include "stringPool.h"
 
 /*
  * createCourseBTNode() takes a Course pointer argument for
@@ -83,9 +84,53 @@ CourseBinaryTree* createCourseBinaryTree() {
 	// and initializing root
 	CourseBinaryTree *newTree = (CourseBinaryTree*) malloc(sizeof(CourseBinaryTree));
 	newTree->root = NULL;
+	newTree->numCourseIds = 0;
+	newTree->idCapacity = 10;
+	newTree->coursesById = (Course**) calloc(newTree->idCapacity, sizeof(Course*));
+	newTree->version = 0;
+	newTree->prereqGraph = NULL;
 	return newTree;
 }
 
+/*
+ * findCourseById() takes a CourseBinaryTree pointer 
+ * and a Course id as arguments
+ *
+ * findCourseById() returns the Course registered with
+ * the id, and NULL if the id has not been handed out
+ * or the Course is no longer on the tree
+ */
+Course* findCourseById(CourseBinaryTree *bt, unsigned int courseId) {
+
+	if (bt == NULL || courseId >= bt->numCourseIds) {
+		return NULL;
+	}
+	return bt->coursesById[courseId];
+}
+
+/*
+ * registerCourseId() takes a CourseBinaryTree pointer
+ * and a pointer to a Course new to the tree
+ *
+ * registerCourseId() gives the Course the next
+ * Course id and records the Course under that id,
+ * doubling the tree's id capacity as necessary, and
+ * bumps the tree's version
+ */
+void registerCourseId(CourseBinaryTree *bt, Course *coursePtr) {
+
+	if (bt->numCourseIds == bt->idCapacity) {
+		unsigned int newCapacity = bt->idCapacity * 2;
+		bt->coursesById = (Course**) realloc(bt->coursesById, newCapacity * sizeof(Course*));
+		bt->idCapacity = newCapacity;
+	}
+	coursePtr->id = bt->numCourseIds;
+	bt->coursesById[bt->numCourseIds] = coursePtr;
+	bt->numCourseIds++;
+	bt->version++;
+	return;
+}
+
 /*
  * findInCourseBinaryTree() takes a reference to the 
  * root of the CourseBinaryTree to be searched and a 
@@ -183,6 +228,7 @@ Course* insertInCourseBinaryTree( CourseBinaryTree* bt, char* courseName ) {
 	// if tree is empty - adding root and return
 	if (bt->root == NULL) {
 		bt->root = newNode;
+		registerCourseId(bt, newNode->coursePtr);
 		return newNode->coursePtr;
 	}
 	// tree is not empty
@@ -205,10 +251,12 @@ Course* insertInCourseBinaryTree( CourseBinaryTree* bt, char* courseName ) {
 	// inserting newNode to the left of leaf node pointer, nodePtr
 	if (strcmp(courseName, nodePtr->coursePtr->name) < 0) {
 		nodePtr->left = newNode;
+		registerCourseId(bt, newNode->coursePtr);
 		return newNode->coursePtr;	
 	// inserting newNode to the right of leaf node pointer, nodePtr
 	} else if (strcmp(courseName, nodePtr->coursePtr->name) > 0) {
 		nodePtr->right = newNode;
+		registerCourseId(bt, newNode->coursePtr);
 		return newNode->coursePtr;
 	// node already exists on the tree
 	} else if (strcmp(courseName, nodePtr->coursePtr->name) == 0) {
@@ -350,9 +398,14 @@ void removeFromCourseBinaryTree( CourseBinaryTree *bt, char *courseName ) {
 		return;
 	}
 
-	// checking for empty tree and calling helper
-	// function
+	// checking for empty tree, retiring the Course's
+	// id, and calling helper function
 	if (bt->root != NULL) {
+		CourseBTNode *courseNode = findInCourseBinaryTree(bt->root, courseName);
+		if (courseNode != NULL) {
+			bt->coursesById[courseNode->coursePtr->id] = NULL;
+			bt->version++;
+		}
 		bt->root = traverseAndRemoveCourse(bt->root, courseName);
 		return;
 	} else {
@@ -365,36 +418,32 @@ void removeFromCourseBinaryTree( CourseBinaryTree *bt, char *courseName ) {
 
 /*
  * traverseAndPrintCoursesWithPrereq() takes a 
- * CourseBTNode pointer (parameter nodePtr), a 
- * C string prerequisite name (parameter prereqName),
+ * CourseBTNode pointer (parameter nodePtr), the id
+ * of the prerequisite Course (parameter prereqId),
  * and an integer counter variable (parameter counterPtr)
  * as arguments
  *
  * traverseAndPrintCoursesWithPrereq() will recursively
  * traverse across a CourseBinaryTree and all of its 
  * subtrees, in-order, checking for Course prerequisites
+ * in each Course's compiled prerequisites
  *
- * if the Course being checked has one prerequisite and
- * the prerequisite is fulfilled (Course's prerequisite
- * Course is prereqName) then the Course's name is printed 
- * to the terminal
- *
- * if the Course being checked has disjunct prerequisites
- * and one of the prerequisite Courses has name prereqName,
- * then the name of available Course is printed to the 
- * terminal
+ * if the Course being checked has a single prerequisite 
+ * clause (one prerequisite, disjunct prerequisites, or
+ * one group) with the prerequisite Course in it, then 
+ * the Course's name is printed to the terminal
  *
- * if the Course being checked has conjunct prerequisite
- * Courses and one of them is prereqName, then the 
+ * if the Course being checked has more than one clause
+ * and one of them has the prerequisite Course, then the 
  * checked Course's name is printed along with the leftover 
- * prerequisite Courses that need to be completed to make 
- * the Course available
+ * prerequisites (one string per clause) that need to be
+ * completed to make the Course available
  *
  * counterPtr is used to determine if commas need be printed
  * to the terminal between Course names - more than one 
  * Course name has been printed
  */
-void traverseAndPrintCoursesWithPrereq( CourseBTNode *nodePtr, char *prereqName, int *counterPtr ) {
+void traverseAndPrintCoursesWithPrereq( CourseBTNode *nodePtr, unsigned int prereqId, int *counterPtr ) {
 
 	// passed over a leaf node
 	if (nodePtr == NULL) {
@@ -402,55 +451,41 @@ void traverseAndPrintCoursesWithPrereq( CourseBTNode *nodePtr, char *prereqName,
 	}
 	
 	// recursive call - left subtree
-	traverseAndPrintCoursesWithPrereq(nodePtr->left, prereqName, counterPtr);
-
-	// checking different prerequisite Course arrangements
-	// and printing Course availability information
-	LinkedListNode *prereqPtr = nodePtr->coursePtr->firstPrereq;
-	if (prereqPtr != NULL) {
-		// only one prerequisite to check
-		if (prereqPtr->next == NULL) {
-			if ( checkCourseForPrerequisite(nodePtr->coursePtr, prereqName) == 1 ) {
-				if ( (*counterPtr) > 0) {
-					printf(", ");
-				}
-				printf("%s", nodePtr->coursePtr->name);
-				(*counterPtr)++;
-			}
+	traverseAndPrintCoursesWithPrereq(nodePtr->left, prereqId, counterPtr);
+
+	// checking the compiled prerequisite clauses and
+	// printing Course availability information
+	PrereqExpr *exprPtr = nodePtr->coursePtr->prereqExpr;
+	if ( prereqExprContains(exprPtr, prereqId) ) {
+		if ( (*counterPtr) > 0) {
+			printf(", ");
 		}
-		// a Course with disjunct prereqs
-		// only one prereq needed to print Course
-		else if ( strcmp(prereqPtr->name, "OR") == 0 ) {
-			if ( checkCourseForPrerequisite(nodePtr->coursePtr, prereqName) == 1 ) {
-				if ( (*counterPtr) > 0) {
-					printf(", ");
-				}
-				printf("%s", nodePtr->coursePtr->name);
-				(*counterPtr)++;
-			}
-		} 
-		// conjunct prerequisite Courses
-		// every prereq must be fulfilled 
-		// to make Course available
+		// one clause - the prerequisite alone makes 
+		// the Course available
+		if (exprPtr->numClauses == 1) {
+			printf("%s", nodePtr->coursePtr->name);
+		}
+		// more clauses - every other clause must be
+		// fulfilled to make Course available
 		else {
-			if ( checkCourseForPrerequisite(nodePtr->coursePtr, prereqName) == 1 ) {
-				if ( (*counterPtr) > 0) {
-					printf(", ");
-				}
-				printf("%s (still requires", nodePtr->coursePtr->name);
-				while (prereqPtr != NULL) {
-					if ( strcmp(prereqPtr->name, prereqName) != 0 ) {
+			printf("%s (still requires", nodePtr->coursePtr->name);
+			LinkedListNode *prereqPtr = nodePtr->coursePtr->firstPrereq;
+			unsigned int clauseIndex = 0;
+			while (prereqPtr != NULL) {
+				if ( strcmp(prereqPtr->name, PREREQ_OR) != 0 ) {
+					if ( !prereqClauseContains(exprPtr, clauseIndex, prereqId) ) {
 						printf(" %s", prereqPtr->name); 
 					}
-					prereqPtr = prereqPtr->next;
-				}	
-				printf(")");
-				(*counterPtr)++;
-			}
+					clauseIndex++;
+				}
+				prereqPtr = prereqPtr->next;
+			}	
+			printf(")");
 		}
+		(*counterPtr)++;
 	}
 	// recursive call - right subtree
-	traverseAndPrintCoursesWithPrereq(nodePtr->right, prereqName, counterPtr);
+	traverseAndPrintCoursesWithPrereq(nodePtr->right, prereqId, counterPtr);
 
 	return;
 }
@@ -489,7 +524,12 @@ void printAllCoursesWithPrerequisite( CourseBinaryTree *bt, char *prereqName ) {
 	if ( bt->root != NULL) {
 		int *counterPtr = (int*) malloc(sizeof(int));
 		*counterPtr = 0;
-		traverseAndPrintCoursesWithPrereq(bt->root, prereqName, counterPtr);
+		// a name that is not on the tree is not
+		// a prerequisite for any Course
+		CourseBTNode *prereqNode = findInCourseBinaryTree(bt->root, prereqName);
+		if (prereqNode != NULL) {
+			traverseAndPrintCoursesWithPrereq(bt->root, prereqNode->coursePtr->id, counterPtr);
+		}
 		if (*counterPtr == 0) {
 			printf("%s is not a prerequisite for "
 					"any Course", prereqName);
@@ -506,37 +546,82 @@ void printAllCoursesWithPrerequisite( CourseBinaryTree *bt, char *prereqName ) {
 }
 
 /*
- * traverseAndRemovePrereqCourse() takes a CourseBTNode pointer
- * (parameter nodePtr) and a C string for a prerequisite Course
- * name (parameter prereqName) as arguments
+ * removeCoursesFromAllPrereqs() takes a CourseBinaryTree
+ * pointer (parameter bt) and a BitSet pointer of the ids
+ * of the prerequisite Courses to be removed (parameter
+ * courseIds) as arguments
  *
- * traverseAndRemovePrereqCourse() traverses the CourseBinaryTree
- * and all of its subtrees removing the prerequisite Course, 
- * prereqName, from all Courses' prerequisite lists on the 
- * CourseBinaryTree
+ * removeCoursesFromAllPrereqs() finds the Courses that
+ * require any of the removed Courses through the removed
+ * Courses' back-references (dependents), without walking
+ * the CourseBinaryTree or comparing any other Course's
+ * prerequisite strings
+ *
+ * each of those Courses has the removed Courses taken out
+ * of its prerequisite list (see
+ * removePrerequisiteFromCourse()) and is compiled again
+ * once, which drops its back-references - its id is set
+ * in changedIds, if given, for updatePrereqClosures()
  */
-void traverseAndRemovePrereqCourse( CourseBTNode *nodePtr, char *prereqName) {
+void removeCoursesFromAllPrereqs(CourseBinaryTree *bt, BitSet *courseIds, BitSet *changedIds) {
 
-	// passed leaf node
-	if (nodePtr == NULL) {
+	// checking for NULL pointer arguments
+	if (bt == NULL || courseIds == NULL) {
+		printf("\nCannot remove prerequisite Courses "
+				"from all Courses' prerequisite "
+				"lists with NULL CourseBinaryTree "
+				"or BitSet pointer argument\n");
 		return;
 	}
-	
-	// recursive call - left subtree
-	traverseAndRemovePrereqCourse(nodePtr->left, prereqName);
 
-	// checking Course's prerequisites and removing prereqName
-	// if present
-	if ( checkCourseForPrerequisite(nodePtr->coursePtr, prereqName) == 1) {
-
-		removeFromLinkedList( &(nodePtr->coursePtr->firstPrereq), prereqName);
+	// gathering every Course that requires a removed
+	// Course before any is compiled again, since that
+	// changes the back-references
+	BitSet *affectedIds = initBitSet(bt->numCourseIds);
+	for (unsigned int w = 0; w < courseIds->numWords; w++) {
+		uint64_t removedBits = courseIds->words[w];
+		while (removedBits != 0) {
+			unsigned int courseId = w * 64 + __builtin_ctzll(removedBits);
+			removedBits &= removedBits - 1;
+			Course *removedPtr = findCourseById(bt, courseId);
+			if (removedPtr == NULL) {
+				continue;
+			}
+			for (unsigned int d = 0; d < removedPtr->numDependents; d++) {
+				setBit(affectedIds, removedPtr->dependents[d]->id);
+			}
+		}
 	}
 
-	// recursive call - right subtree
-	traverseAndRemovePrereqCourse(nodePtr->right, prereqName);
+	for (unsigned int w = 0; w < affectedIds->numWords; w++) {
+		uint64_t affectedBits = affectedIds->words[w];
+		while (affectedBits != 0) {
+			unsigned int affectedId = w * 64 + __builtin_ctzll(affectedBits);
+			affectedBits &= affectedBits - 1;
+			Course *coursePtr = bt->coursesById[affectedId];
+			if (coursePtr == NULL) {
+				continue;
+			}
+			// the Course's compiled prerequisites name
+			// the removed Courses it has
+			PrereqExpr *exprPtr = coursePtr->prereqExpr;
+			if (exprPtr != NULL) {
+				unsigned int *prereqIds = prereqCourseIds(exprPtr);
+				for (unsigned int term = 0; term < exprPtr->numTerms; term++) {
+					if ( testBit(courseIds, prereqIds[term]) ) {
+						removePrerequisiteFromCourse(coursePtr, bt->coursesById[prereqIds[term]]->name);
+					}
+				}
+			}
+			compileCoursePrerequisites(bt, coursePtr);
+			if (changedIds != NULL) {
+				setBit(changedIds, affectedId);
+			}
+		}
+	}
 
+	freeBitSet(affectedIds);
 	return;
-
 }
 
 /*
@@ -546,10 +631,13 @@ void traverseAndRemovePrereqCourse( CourseBTNode *nodePtr, char *prereqName) {
  * (parameter prereqName) as arguments
  *
  * removeCourseFromAllPrereqs() checks for vaild input
- * and then passes the appropriate arguments into the
- * helper function, traverseAndRemovePrereqCourse(), to 
- * remove every instance of prereqName from all Courses'
- * prerequisite lists in the CourseBinaryTree, *bt
+ * and then passes the Course's id to
+ * removeCoursesFromAllPrereqs() to remove every instance
+ * of prereqName from all Courses' prerequisite lists in
+ * the CourseBinaryTree, *bt
+ *
+ * every prerequisite is on the tree, so a name that is
+ * not on it is not a prerequisite of any Course
  */
 void removeCourseFromAllPrereqs( CourseBinaryTree *bt, char *prereqName) {
 
@@ -574,7 +662,13 @@ void removeCourseFromAllPrereqs( CourseBinaryTree *bt, char *prereqName) {
 	// calling helper function
 	if (bt->root != NULL) {
 
-		traverseAndRemovePrereqCourse( bt->root, prereqName);
+		CourseBTNode *prereqNode = findInCourseBinaryTree(bt->root, prereqName);
+		if (prereqNode != NULL) {
+			BitSet *courseIds = initBitSet(bt->numCourseIds);
+			setBit(courseIds, prereqNode->coursePtr->id);
+			removeCoursesFromAllPrereqs(bt, courseIds, NULL);
+			freeBitSet(courseIds);
+		}
 		return;
 	// empty CourseBinaryTree
 	} else {
@@ -585,3 +679,138 @@ void removeCourseFromAllPrereqs( CourseBinaryTree *bt, char *prereqName) {
 		return;
 	}
 }
+
+/*
+ * findOrInsertGroupCourse() takes a CourseBinaryTree
+ * pointer and a heap copy of a Course name from a
+ * prerequisite group as arguments
+ *
+ * findOrInsertGroupCourse() pools the copy (see
+ * stringPool.h), which frees it if the name is already
+ * pooled, and returns the Course with that name,
+ * inserting it in the tree if it is not there yet
+ */
+Course* findOrInsertGroupCourse(CourseBinaryTree *bt, char *courseName) {
+
+	courseName = internHeapString(courseName);
+	CourseBTNode *courseNode = findInCourseBinaryTree(bt->root, courseName);
+	if (courseNode != NULL) {
+		return courseNode->coursePtr;
+	}
+	return insertInCourseBinaryTree(bt, courseName);
+}
+
+/*
+ * compileCoursePrerequisites() takes a CourseBinaryTree
+ * pointer and a Course pointer as arguments
+ *
+ * compileCoursePrerequisites() frees the Course's old
+ * PrereqExpr and compiles its prerequisite strings into
+ * a new one (see prereqExpr.h):
+ * 	a leading OR - a single clause of every Course
+ * 	otherwise - one clause per string, where a
+ * 	group in parentheses is a clause of all of its
+ * 	Courses
+ *
+ * every prerequisite Course is put on the tree, as
+ * loading a Department does, so that it has an id -
+ * a Course named before its Department is loaded is a
+ * placeholder until then - and is given a back-reference
+ * to the Course, after the back-references of the old
+ * prerequisites are dropped
+ *
+ * a Course with no prerequisites is left with no
+ * PrereqExpr
+ */
+void compileCoursePrerequisites(CourseBinaryTree *bt, Course *coursePtr) {
+
+	// checking for NULL pointer arguments
+	if (bt == NULL) {
+		printf("\nCannot compile prerequisites with "
+				"NULL CourseBinaryTree pointer "
+				"argument\n");
+		return;
+	}
+	if (coursePtr == NULL) {
+		printf("\nCannot compile prerequisites with "
+				"NULL Course pointer argument\n");
+		return;
+	}
+
+	bt->version++;
+	// dropping the back-references of the old prerequisites
+	if (coursePtr->prereqExpr != NULL) {
+		unsigned int *oldIds = prereqCourseIds(coursePtr->prereqExpr);
+		for (unsigned int term = 0; term < coursePtr->prereqExpr->numTerms; term++) {
+			Course *prereqPtr = findCourseById(bt, oldIds[term]);
+			if (prereqPtr != NULL) {
+				removeDependentFromCourse(prereqPtr, coursePtr);
+			}
+		}
+	}
+	freePrereqExpr(coursePtr->prereqExpr);
+	coursePtr->prereqExpr = NULL;
+	LinkedListNode *firstPtr = coursePtr->firstPrereq;
+	if (firstPtr == NULL) {
+		return;
+	}
+
+	// a leading OR makes the whole list one clause
+	bool oneClause = ( strcmp(firstPtr->name, PREREQ_OR) == 0 );
+	if (oneClause) {
+		firstPtr = firstPtr->next;
+	}
+
+	// counting clauses and Course ids
+	unsigned int numClauses = oneClause ? 1 : 0;
+	unsigned int numTerms = 0;
+	for (LinkedListNode *prereqPtr = firstPtr; prereqPtr != NULL; prereqPtr = prereqPtr->next) {
+		if ( strcmp(prereqPtr->name, PREREQ_OR) == 0 ) {
+			continue;
+		}
+		if ( isPrereqGroup(prereqPtr->name) ) {
+			numTerms += countPrereqGroupNames(prereqPtr->name);
+		} else {
+			numTerms++;
+		}
+		if (!oneClause) {
+			numClauses++;
+		}
+	}
+
+	// filling in the Course ids and clause ends
+	PrereqExpr *exprPtr = initPrereqExpr(numClauses, numTerms);
+	unsigned int *clauseEnds = prereqClauseEnds(exprPtr);
+	unsigned int *courseIds = prereqCourseIds(exprPtr);
+	unsigned int clauseIndex = 0;
+	unsigned int term = 0;
+	for (LinkedListNode *prereqPtr = firstPtr; prereqPtr != NULL; prereqPtr = prereqPtr->next) {
+		if ( strcmp(prereqPtr->name, PREREQ_OR) == 0 ) {
+			continue;
+		}
+		if ( isPrereqGroup(prereqPtr->name) ) {
+			int numNames = countPrereqGroupNames(prereqPtr->name);
+			for (int i = 0; i < numNames; i++) {
+				char *courseName = copyPrereqGroupName(prereqPtr->name, i);
+				Course *groupCoursePtr = findOrInsertGroupCourse(bt, courseName);
+				courseIds[term] = groupCoursePtr->id;
+				addDependentToCourse(groupCoursePtr, coursePtr);
+				term++;
+			}
+		} else {
+			Course *prereqCoursePtr = insertInCourseBinaryTree(bt, prereqPtr->name);
+			courseIds[term] = prereqCoursePtr->id;
+			addDependentToCourse(prereqCoursePtr, coursePtr);
+			term++;
+		}
+		if (!oneClause) {
+			clauseEnds[clauseIndex] = term;
+			clauseIndex++;
+		}
+	}
+	if (oneClause) {
+		clauseEnds[0] = term;
+	}
+	coursePtr->prereqExpr = exprPtr;
+	return;
+}
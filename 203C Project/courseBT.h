@@ -52,9 +52,25 @@ typedef struct courseBTNode {
  * struct for binary search tree containing 
  * the root node pointer
  * the tree is organized lexicographically
+ *
+ * the tree also hands out Course ids - coursesById
+ * maps every id given out so far (numCourseIds) to
+ * its Course, or to NULL once the Course has been
+ * removed from the tree
+ *
+ * version is bumped whenever a Course is inserted or
+ * removed or a Course's prerequisites are compiled, so
+ * the prerequisite graph built from the tree (see
+ * prereqGraph.h) knows when to be built again
  */
+struct prereqGraph;
 typedef struct courseBinaryTree {
 	CourseBTNode *root;
+	unsigned int numCourseIds;
+	unsigned int idCapacity;
+	Course **coursesById;
+	unsigned int version;
+	struct prereqGraph *prereqGraph;
 } CourseBinaryTree;
 
 
@@ -95,12 +111,24 @@ CourseBinaryTree* createCourseBinaryTree();
 CourseBTNode* findInCourseBinaryTree(CourseBTNode* rootPtr, char* courseName);
 
 
+/*
+ * returns the Course with the given Course id,
+ * or NULL if the id was never handed out or
+ * its Course has been removed from the tree
+ *
+ * bt - pointer to a CourseBinaryTree
+ *
+ * courseId - id of the Course we want
+ */
+Course* findCourseById(CourseBinaryTree* bt, unsigned int courseId);
+
+
 /*
  * searches CourseBinaryTree for a spot to insert
  * a CourseBTNode with given Course name
  * if the location is found and empty, then a node is
- * inserted into the tree and a Course pointer is 
- * returned
+ * inserted into the tree, the new Course is given the 
+ * next Course id, and a Course pointer is returned
  * if the location is found to be filled, then a pointer
  * to the previously existing Course is returned
  *
@@ -150,4 +178,33 @@ void printAllCoursesWithPrerequisite(CourseBinaryTree* bt, char* prereqName);
  */ 
 void removeCourseFromAllPrereqs(CourseBinaryTree* bt, char* prereqName);
 
+/*
+ * removes every Course with an id in the BitSet
+ * from all Courses' prerequisite lists, visiting
+ * only the Courses that require one of them, and
+ * compiles each changed Course again
+ *
+ * bt - pointer to CourseBinaryTree
+ *
+ * courseIds - pointer to the BitSet of ids of
+ * the prerequisite Courses to be removed
+ *
+ * changedIds - pointer to a BitSet the ids of
+ * the changed Courses are set in, or NULL
+ */
+void removeCoursesFromAllPrereqs(CourseBinaryTree* bt, BitSet* courseIds, BitSet* changedIds);
+
+/*
+ * compiles a Course's prerequisite strings into
+ * its PrereqExpr of Course ids (see prereqExpr.h),
+ * putting every prerequisite Course on the tree -
+ * called whenever the prerequisite strings change
+ *
+ * bt - pointer to CourseBinaryTree
+ *
+ * coursePtr - pointer to the Course whose
+ * prerequisites are compiled
+ */
+void compileCoursePrerequisites(CourseBinaryTree* bt, Course* coursePtr);
+
 #endif
@@ -22,6 +22,7 @@
 #include <stdbool.h>
 #include "course.h"
 #include "coursePtrVector.h"
+#include "stringPool.h"
 
 
 /*
@@ -78,23 +79,337 @@ void linkDisjunct(Element *elementPtr, Element *disjunctPtr) {
 
 
 /*
- * initVector() allocates heap space for a Vector
- * and allocates heap space for ten Elements
- * and then initializes the Vector data members:
+ * inlineSortedCourses() takes a Vector pointer as an
+ * argument and returns a pointer to the room for its
+ * inline sorted index, right after its inline Elements
+ */
+Course** inlineSortedCourses(Vector *vectorPtr) {
+
+	return (Course**) (vectorPtr->inlineElements + vectorPtr->inlineCapacity);
+}
+
+/*
+ * vectorSize() takes an inline capacity and whether the
+ * Vector is sorted as arguments and returns the size of
+ * the Vector struct plus its inline Elements and, for a
+ * sorted Vector, its inline sorted index
+ */
+size_t vectorSize(unsigned int inlineCapacity, bool sorted) {
+
+	size_t size = sizeof(Vector) + inlineCapacity * sizeof(Element);
+	if (sorted) {
+		size += inlineCapacity * sizeof(Course*);
+	}
+	return size;
+}
+
+/*
+ * placeVector() takes a pointer to storage, an inline
+ * capacity, and whether the Vector is sorted as arguments
+ *
+ * placeVector() initializes the Vector data members in
+ * the storage:
  * 	the number of Elements in the Vector at a given time, numElements
  *	the maximum number of Elements given the allocated space, capacity
  *	the pointer the Vector's Elements, elements
+ * elements (and sortedCourses, for a sorted Vector) point
+ * to the inline storage, so the capacity starts at the
+ * inline capacity and numElements at zero
+ *
+ * the inline capacity must be at least one, since the
+ * storage was sized for it with vectorSize()
+ *
+ * returns NULL for error
+ */
+Vector* placeVector(void *storage, unsigned int inlineCapacity, bool sorted) {
+
+	// checking for NULL pointer argument
+	if (storage == NULL) {
+		printf("\nCannot place a Vector with NULL "
+				"storage pointer argument\n");
+		return NULL;
+	}
+	if (inlineCapacity == 0) {
+		printf("\nCannot place a Vector with no "
+				"inline capacity\n");
+		return NULL;
+	}
+
+	Vector *vectorPtr = (Vector*) storage;
+	// filling in data members
+	vectorPtr->version = 1;
+	vectorPtr->numElements = 0;
+	vectorPtr->capacity = inlineCapacity;
+	vectorPtr->inlineCapacity = inlineCapacity;
+	vectorPtr->elements = vectorPtr->inlineElements;
+	vectorPtr->disjunctChunks = NULL;
+	vectorPtr->freeDisjuncts = NULL;
+	vectorPtr->sortedCourses = NULL;
+	if (sorted) {
+		vectorPtr->sortedCourses = inlineSortedCourses(vectorPtr);
+	}
+	return vectorPtr;
+}
+
+/*
+ * initVector() allocates heap space for a Vector and
+ * inline storage for ten Elements in one block and
+ * then initializes it with placeVector()
+ *
  * Each Vector starts with a capacity of 10, and a numElements of zero
  */
 Vector* initVector() {
 
 	// allocating heap space
-	Vector *vectorPtr = (Vector*) malloc(sizeof(Vector));
-	// filling in data members
+	void *storage = malloc( vectorSize(VECTOR_MIN_CAPACITY, false) );
+	return placeVector(storage, VECTOR_MIN_CAPACITY, false);
+}
+
+/*
+ * initSortedVector() allocates heap space for a Vector
+ * the same way initVector() does, with room in the same
+ * block for the Vector's index of Course pointers sorted
+ * by Course name, which has the same capacity as the
+ * Vector
+ *
+ * a sorted Vector is used as a set of Courses - its
+ * Elements have no disjuncts
+ */
+Vector* initSortedVector() {
+
+	// allocating heap space
+	void *storage = malloc( vectorSize(VECTOR_MIN_CAPACITY, true) );
+	return placeVector(storage, VECTOR_MIN_CAPACITY, true);
+}
+
+/*
+ * findSortedPosition() takes a sorted Vector pointer and
+ * a Course name as arguments
+ *
+ * findSortedPosition() binary searches the Vector's
+ * sorted index and returns the position of the first
+ * Course whose name is not less than courseName - the
+ * position courseName is at, or would be inserted at
+ */
+unsigned int findSortedPosition(Vector *vectorPtr, char *courseName) {
+
+	unsigned int low = 0;
+	unsigned int high = vectorPtr->numElements;
+	while (low < high) {
+		unsigned int middle = low + (high - low) / 2;
+		if ( strcmp(vectorPtr->sortedCourses[middle]->name, courseName) < 0 ) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+	return low;
+}
+
+/*
+ * addToSortedIndex() takes a sorted Vector pointer and
+ * a Course pointer as arguments and inserts the Course
+ * into the Vector's sorted index, shifting the Courses
+ * after it by one
+ *
+ * the index must have room for one more Course
+ */
+void addToSortedIndex(Vector *vectorPtr, Course *coursePtr) {
+
+	unsigned int position = findSortedPosition(vectorPtr, coursePtr->name);
+	memmove(vectorPtr->sortedCourses + position + 1, vectorPtr->sortedCourses + position,
+			(vectorPtr->numElements - position) * sizeof(Course*));
+	vectorPtr->sortedCourses[position] = coursePtr;
+	return;
+}
+
+/*
+ * removeFromSortedIndex() takes a sorted Vector pointer
+ * and a Course pointer as arguments and removes the
+ * Course from the Vector's sorted index, shifting the
+ * Courses after it back by one
+ *
+ * numElements must still count the Course
+ */
+void removeFromSortedIndex(Vector *vectorPtr, Course *coursePtr) {
+
+	unsigned int position = findSortedPosition(vectorPtr, coursePtr->name);
+	// stepping over other Courses with the same name
+	while (position < vectorPtr->numElements && vectorPtr->sortedCourses[position] != coursePtr) {
+		position++;
+	}
+	if (position == vectorPtr->numElements) {
+		return;
+	}
+	memmove(vectorPtr->sortedCourses + position, vectorPtr->sortedCourses + position + 1,
+			(vectorPtr->numElements - position - 1) * sizeof(Course*));
+	return;
+}
+
+/*
+ * releaseVector() takes a Vector pointer as an argument
+ * and frees every chunk of the Vector's disjunct Element
+ * pool and the heap storage of its Elements and sorted
+ * index, if they have spilled out of the inline storage
+ *
+ * the Vector is left empty, back on its inline storage
+ */
+void releaseVector(Vector *vectorPtr) {
+
+	if (vectorPtr == NULL) {
+		return;
+	}
+
+	ElementChunk *chunkPtr = vectorPtr->disjunctChunks;
+	while (chunkPtr != NULL) {
+		ElementChunk *nextChunkPtr = chunkPtr->next;
+		free(chunkPtr);
+		chunkPtr = nextChunkPtr;
+	}
+	vectorPtr->disjunctChunks = NULL;
+	vectorPtr->freeDisjuncts = NULL;
+	if (vectorPtr->elements != vectorPtr->inlineElements) {
+		free(vectorPtr->elements);
+		if (vectorPtr->sortedCourses != NULL) {
+			free(vectorPtr->sortedCourses);
+		}
+	}
+	vectorPtr->elements = vectorPtr->inlineElements;
+	if (vectorPtr->sortedCourses != NULL) {
+		vectorPtr->sortedCourses = inlineSortedCourses(vectorPtr);
+	}
 	vectorPtr->numElements = 0;
-	vectorPtr->capacity = 10;
-	vectorPtr->elements = (Element*) calloc( (vectorPtr->capacity), sizeof(Element) );
-	return vectorPtr;
+	vectorPtr->capacity = vectorPtr->inlineCapacity;
+	vectorPtr->version++;
+	return;
+}
+
+/*
+ * freeVector() takes a Vector pointer as an argument
+ * and releases the Vector's storage with releaseVector()
+ * and then frees the Vector itself
+ */
+void freeVector(Vector *vectorPtr) {
+
+	if (vectorPtr == NULL) {
+		return;
+	}
+
+	releaseVector(vectorPtr);
+	free(vectorPtr);
+	return;
+}
+
+/*
+ * resizeVector() takes a Vector pointer and a new
+ * capacity as arguments and moves the Vector's
+ * Elements (and its sorted index, if any) to storage
+ * for exactly newCapacity Elements
+ *
+ * the capacity never goes below the inline capacity -
+ * at the inline capacity the Vector moves back to its
+ * inline storage, and past it the Vector spills to (or
+ * reallocates) heap storage
+ *
+ * newCapacity must be at least numElements
+ */
+void resizeVector(Vector *vectorPtr, unsigned int newCapacity) {
+
+	if (newCapacity < vectorPtr->inlineCapacity) {
+		newCapacity = vectorPtr->inlineCapacity;
+	}
+	if (newCapacity == vectorPtr->capacity) {
+		return;
+	}
+
+	unsigned int numElements = vectorPtr->numElements;
+	bool isInline = (vectorPtr->elements == vectorPtr->inlineElements);
+	if (newCapacity == vectorPtr->inlineCapacity) {
+		// moving back into the inline storage
+		memcpy(vectorPtr->inlineElements, vectorPtr->elements, numElements * sizeof(Element));
+		free(vectorPtr->elements);
+		vectorPtr->elements = vectorPtr->inlineElements;
+		if (vectorPtr->sortedCourses != NULL) {
+			Course **sortedCourses = inlineSortedCourses(vectorPtr);
+			memcpy(sortedCourses, vectorPtr->sortedCourses, numElements * sizeof(Course*));
+			free(vectorPtr->sortedCourses);
+			vectorPtr->sortedCourses = sortedCourses;
+		}
+	} else if (isInline) {
+		// spilling out of the inline storage
+		Element *elements = (Element*) malloc(newCapacity * sizeof(Element));
+		memcpy(elements, vectorPtr->elements, numElements * sizeof(Element));
+		vectorPtr->elements = elements;
+		if (vectorPtr->sortedCourses != NULL) {
+			Course **sortedCourses = (Course**) malloc(newCapacity * sizeof(Course*));
+			memcpy(sortedCourses, vectorPtr->sortedCourses, numElements * sizeof(Course*));
+			vectorPtr->sortedCourses = sortedCourses;
+		}
+	} else {
+		vectorPtr->elements = (Element*) realloc(vectorPtr->elements, newCapacity * sizeof(Element));
+		if (vectorPtr->sortedCourses != NULL) {
+			vectorPtr->sortedCourses = (Course**) realloc(vectorPtr->sortedCourses, newCapacity * sizeof(Course*));
+		}
+	}
+	vectorPtr->capacity = newCapacity;
+	return;
+}
+
+/*
+ * reserveVector() takes a Vector pointer and a number
+ * of Elements as arguments
+ *
+ * reserveVector() grows the Vector's capacity to
+ * minCapacity in one step if it is smaller, so that
+ * minCapacity Elements can be added without another
+ * reallocation
+ */
+void reserveVector(Vector *vectorPtr, unsigned int minCapacity) {
+
+	// checking for NULL pointer argument
+	if (vectorPtr == NULL) {
+		printf("\nCannot reserve space in a Vector "
+				"with NULL Vector pointer "
+				"argument\n");
+		return;
+	}
+
+	if (vectorPtr->capacity < minCapacity) {
+		resizeVector(vectorPtr, minCapacity);
+	}
+	return;
+}
+
+/*
+ * shrinkVectorToFit() takes a Vector pointer as an
+ * argument and reduces the Vector's capacity to its
+ * number of Elements (at least its inline capacity)
+ */
+void shrinkVectorToFit(Vector *vectorPtr) {
+
+	// checking for NULL pointer argument
+	if (vectorPtr == NULL) {
+		printf("\nCannot shrink a Vector with NULL "
+				"Vector pointer argument\n");
+		return;
+	}
+
+	resizeVector(vectorPtr, vectorPtr->numElements);
+	return;
+}
+
+/*
+ * growVectorIfFull() takes a Vector pointer as an
+ * argument and doubles the Vector's capacity (and
+ * that of its sorted index, if any) if there is no
+ * room for another Element
+ */
+void growVectorIfFull(Vector *vectorPtr) {
+
+	if (vectorPtr->numElements == vectorPtr->capacity) {
+		resizeVector(vectorPtr, vectorPtr->capacity * 2);
+	}
+	return;
 }
 
 /*
@@ -119,30 +434,211 @@ void addElement(Vector *vectorPtr, Element *elementPtr) {
 		return;
 	}
 	// double capacity if needed
-	if (vectorPtr->numElements == vectorPtr->capacity) {
-		int originalCapacity = vectorPtr->capacity;
-		int newCapacity = originalCapacity * 2;
-		vectorPtr->elements = (Element*) realloc(vectorPtr->elements, newCapacity * sizeof(Element));
-		vectorPtr->capacity = newCapacity;
+	growVectorIfFull(vectorPtr);
+
+	// a sorted Vector only holds single Courses
+	if (vectorPtr->sortedCourses != NULL) {
+		if (elementPtr->disjunct != NULL) {
+			printf("\nCannot add an Element with "
+					"disjuncts to a sorted "
+					"Vector\n");
+			return;
+		}
+		addToSortedIndex(vectorPtr, elementPtr->course);
 	}
 
 	// adding Element to the Vector and updating Vector's number of elements
 	int originalSize = vectorPtr->numElements;
 	vectorPtr->elements[originalSize] = *elementPtr;
 	vectorPtr->numElements = originalSize + 1;
+	vectorPtr->version++;
 	return;
 }	
 
+/*
+ * emplaceElement() takes a Vector pointer, vectorPtr, and a Course
+ * pointer, coursePtr, as arguments
+ * emplaceElement() initializes the next free Element in the Vector's
+ * own storage with coursePtr and no disjunct - no Element is allocated
+ * emplaceElement() doubles the Vector capacity as necessary and
+ * returns a pointer to the new Element in the Vector
+ */
+Element* emplaceElement(Vector *vectorPtr, Course *coursePtr) {
+
+	// checking for null pointers
+	if (vectorPtr == NULL) {
+		printf("\nCannot emplace Element in Vector "
+				"with NULL Vector pointer "
+				"argument\n");
+		return NULL;
+	}
+	if (coursePtr == NULL) {
+		printf("\nCannot emplace Element in Vector "
+				"with NULL Course pointer "
+				"argument\n");
+		return NULL;
+	}
+	// double capacity if needed
+	growVectorIfFull(vectorPtr);
+
+	if (vectorPtr->sortedCourses != NULL) {
+		addToSortedIndex(vectorPtr, coursePtr);
+	}
+
+	// initializing the Element in place and updating Vector's number of elements
+	Element *elementPtr = vectorPtr->elements + vectorPtr->numElements;
+	elementPtr->disjunct = NULL;
+	elementPtr->course = coursePtr;
+	vectorPtr->numElements++;
+	vectorPtr->version++;
+	return elementPtr;
+}
+
+/*
+ * compareCourseNames() compares two Course pointers by
+ * Course name for qsort()
+ */
+int compareCourseNames(const void *firstPtr, const void *secondPtr) {
+
+	Course *firstCoursePtr = *(Course* const*) firstPtr;
+	Course *secondCoursePtr = *(Course* const*) secondPtr;
+	return strcmp(firstCoursePtr->name, secondCoursePtr->name);
+}
+
+/*
+ * emplaceElements() takes a Vector pointer, vectorPtr, an array
+ * of Course pointers, courses, and the number of Courses in the
+ * array, numCourses, as arguments
+ * emplaceElements() reserves room for all of the Courses at once
+ * and builds one Element per Course at the end of the Vector, in
+ * the order of the array
+ * a sorted Vector's index is sorted once after all Courses are
+ * appended instead of once per Course
+ */
+void emplaceElements(Vector *vectorPtr, Course **courses, unsigned int numCourses) {
+
+	// checking for null pointers
+	if (vectorPtr == NULL) {
+		printf("\nCannot emplace Elements in Vector "
+				"with NULL Vector pointer "
+				"argument\n");
+		return;
+	}
+	if (courses == NULL && numCourses > 0) {
+		printf("\nCannot emplace Elements in Vector "
+				"with NULL Course array "
+				"argument\n");
+		return;
+	}
+	// one reallocation, if any, for all of the Courses
+	reserveVector(vectorPtr, vectorPtr->numElements + numCourses);
+
+	Element *elementPtr = vectorPtr->elements + vectorPtr->numElements;
+	for (unsigned int i = 0; i < numCourses; i++) {
+		elementPtr[i].disjunct = NULL;
+		elementPtr[i].course = courses[i];
+	}
+	if (vectorPtr->sortedCourses != NULL) {
+		memcpy(vectorPtr->sortedCourses + vectorPtr->numElements, courses, numCourses * sizeof(Course*));
+		qsort(vectorPtr->sortedCourses, vectorPtr->numElements + numCourses, sizeof(Course*), compareCourseNames);
+	}
+	vectorPtr->numElements += numCourses;
+	vectorPtr->version++;
+	return;
+}
+
+/*
+ * takeDisjunctFromPool() takes a Vector pointer as an
+ * argument and returns an unused Element from the
+ * Vector's disjunct pool
+ *
+ * Elements released back to the pool are reused first;
+ * otherwise the next Element of the newest chunk is
+ * handed out, and a new chunk is allocated only when
+ * the newest chunk is full
+ */
+Element* takeDisjunctFromPool(Vector *vectorPtr) {
+
+	// reusing a released disjunct Element
+	if (vectorPtr->freeDisjuncts != NULL) {
+		Element *elementPtr = vectorPtr->freeDisjuncts;
+		vectorPtr->freeDisjuncts = elementPtr->disjunct;
+		return elementPtr;
+	}
+	// starting a new chunk if needed
+	ElementChunk *chunkPtr = vectorPtr->disjunctChunks;
+	if (chunkPtr == NULL || chunkPtr->numUsed == ELEMENT_CHUNK_SIZE) {
+		chunkPtr = (ElementChunk*) malloc(sizeof(ElementChunk));
+		chunkPtr->next = vectorPtr->disjunctChunks;
+		chunkPtr->numUsed = 0;
+		vectorPtr->disjunctChunks = chunkPtr;
+	}
+	Element *elementPtr = chunkPtr->elements + chunkPtr->numUsed;
+	chunkPtr->numUsed++;
+	return elementPtr;
+}
+
+/*
+ * releaseDisjunctToPool() takes a Vector pointer and
+ * a disjunct Element pointer that has been unlinked
+ * from its disjunct list and puts the Element on the
+ * Vector's list of reusable disjunct Elements
+ */
+void releaseDisjunctToPool(Vector *vectorPtr, Element *elementPtr) {
+
+	elementPtr->course = NULL;
+	elementPtr->disjunct = vectorPtr->freeDisjuncts;
+	vectorPtr->freeDisjuncts = elementPtr;
+	return;
+}
+
+/*
+ * emplaceDisjunct() takes a Vector pointer, vectorPtr, an Element
+ * pointer, elementPtr, and a Course pointer, coursePtr, as arguments
+ * emplaceDisjunct() initializes a disjunct Element from the Vector's
+ * pool with coursePtr and links it as elementPtr's disjunct
+ * emplaceDisjunct() returns a pointer to the new disjunct Element
+ */
+Element* emplaceDisjunct(Vector *vectorPtr, Element *elementPtr, Course *coursePtr) {
+
+	// checking for null pointers
+	if (vectorPtr == NULL || elementPtr == NULL) {
+		printf("\nCannot emplace disjunct Element "
+				"with NULL Vector or Element "
+				"pointer argument\n");
+		return NULL;
+	}
+	if (coursePtr == NULL) {
+		printf("\nCannot emplace disjunct Element "
+				"with NULL Course pointer "
+				"argument\n");
+		return NULL;
+	}
+	if (vectorPtr->sortedCourses != NULL) {
+		printf("\nCannot emplace disjunct Element "
+				"in a sorted Vector\n");
+		return NULL;
+	}
+
+	Element *disjunctPtr = takeDisjunctFromPool(vectorPtr);
+	disjunctPtr->disjunct = NULL;
+	disjunctPtr->course = coursePtr;
+	linkDisjunct(elementPtr, disjunctPtr);
+	vectorPtr->version++;
+	return disjunctPtr;
+}
+
 
 /*
  * removeNextElementInDisjunctList() removes the disjunct of the
- * Element pointer argument and links the elementPtr to
- * the next disjunct node in the linked list
+ * Element pointer argument, links the elementPtr to the next 
+ * disjunct node in the linked list, and releases the removed 
+ * disjunct Element back to the Vector's pool
  */
-void removeNextElementInDisjunctList(Element *elementPtr) {
+void removeNextElementInDisjunctList(Vector *vectorPtr, Element *elementPtr) {
 
 	// checking for NULL pointer arguments
-	if (elementPtr == NULL) {
+	if (elementPtr == NULL || elementPtr->disjunct == NULL) {
 		printf("\nCannot remove next Element in "
 				"disjunct Element list with "
 				"NULL Element pointer "
@@ -153,12 +649,13 @@ void removeNextElementInDisjunctList(Element *elementPtr) {
 	// unlinking and relinking
 	Element *disjunctPtr = elementPtr->disjunct;
 	elementPtr->disjunct = disjunctPtr->disjunct;
+	releaseDisjunctToPool(vectorPtr, disjunctPtr);
 	return;
 }
 
 /*
- * overwriteHeadElementOfDisjunctList() takes an Element
- * pointer as an argument, headPtr
+ * overwriteHeadElementOfDisjunctList() takes a Vector
+ * pointer and an Element pointer as arguments, headPtr
  *
  * headPtr points to an Element in a Vector's allotted
  * contiguous space - instead of in a linked list of 
@@ -172,7 +669,7 @@ void removeNextElementInDisjunctList(Element *elementPtr) {
  * overwriteHeadElementOfDisjunctList() removes the 
  * extraneous disjunct node
  */
-void overwriteHeadElementOfDisjunctList(Element *headPtr) {
+void overwriteHeadElementOfDisjunctList(Vector *vectorPtr, Element *headPtr) {
 
 	// checking for valid input
 	if (headPtr == NULL) {
@@ -189,15 +686,15 @@ void overwriteHeadElementOfDisjunctList(Element *headPtr) {
 		// into the head element
 		headPtr->course = headPtr->disjunct->course;
 		// removing the first disjunct Course
-		removeNextElementInDisjunctList(headPtr);
+		removeNextElementInDisjunctList(vectorPtr, headPtr);
 	}
 	return;
 }
 
 /*
- * removeElementFromDisjunctList() takes an Element pointer, 
- * disjunctList, and a Course name string, courseName, as
- * arguments
+ * removeElementFromDisjunctList() takes a Vector pointer,
+ * an Element pointer, disjunctList, and a Course name string, 
+ * courseName, as arguments
  *
  * removeElementFromDisjunctList() traverses an Element's
  * linked list of disjunct Elements and removes the Element
@@ -205,7 +702,7 @@ void overwriteHeadElementOfDisjunctList(Element *headPtr) {
  *
  * relinks disjunct Elements if necessary
  */
-void removeElementFromDisjunctList(Element *disjunctList, char *courseName) {
+void removeElementFromDisjunctList(Vector *vectorPtr, Element *disjunctList, char *courseName) {
 
 	// checking for NULL pointer arguments	
 	if (courseName == NULL) {
@@ -224,14 +721,14 @@ void removeElementFromDisjunctList(Element *disjunctList, char *courseName) {
 	// pointing tempPtr to list head	
 	Element *tempPtr = disjunctList;
 	// looping through disjunct elements and removing
-	// Element if present
-	Element *disjunctPtr = tempPtr->disjunct;
-	while (disjunctPtr != NULL) {
-		if ( strcmp(disjunctPtr->course->name, courseName) == 0 ) {
-			removeNextElementInDisjunctList(tempPtr);
+	// Element if present - tempPtr only moves forward
+	// when its disjunct is kept
+	while (tempPtr->disjunct != NULL) {
+		if ( strcmp(tempPtr->disjunct->course->name, courseName) == 0 ) {
+			removeNextElementInDisjunctList(vectorPtr, tempPtr);
+		} else {
+			tempPtr = tempPtr->disjunct;
 		}
-		tempPtr = disjunctPtr;
-		disjunctPtr = disjunctPtr->disjunct;
 	}
 	return;
 }
@@ -247,8 +744,11 @@ void removeElementFromDisjunctList(Element *disjunctList, char *courseName) {
  * with the Element one space higher until all Elements have been
  * shifted 
  *
- * removeElementFromVector() adjusts the capacity of the Vector 
- * if necessary by half
+ * removeElementFromVector() halves the capacity of the Vector 
+ * once it is only a quarter full (but never below its
+ * inline capacity) - after halving, the Vector is still
+ * half empty, so alternating adds and removes do not 
+ * reallocate every time
  *
  * removeElementFromVector() does not remove Elements from
  * disjunct linked lists
@@ -269,6 +769,10 @@ void removeElementFromVector(Vector *vectorPtr, int elementIndex) {
 		return;
 	}
 
+	if (vectorPtr->sortedCourses != NULL) {
+		removeFromSortedIndex(vectorPtr, vectorPtr->elements[elementIndex].course);
+	}
+
 	// overwriting Element to remove and shifting Vector Elements
 	for (int i = (elementIndex + 1); i < vectorPtr->numElements; i++) {
 		Element *tempPtr = vectorPtr->elements + (i-1);
@@ -280,13 +784,11 @@ void removeElementFromVector(Vector *vectorPtr, int elementIndex) {
 	}
 
 	vectorPtr->numElements--;
+	vectorPtr->version++;
 
-	// half double capacity if needed
-	if (vectorPtr->numElements == (vectorPtr->capacity) / 2) {
-		int originalCapacity = vectorPtr->capacity;
-		int newCapacity = originalCapacity / 2;
-		vectorPtr->elements = (Element*) realloc(vectorPtr->elements, newCapacity * sizeof(Element));
-		vectorPtr->capacity = newCapacity;
+	// halving capacity if the Vector is a quarter full
+	if ( vectorPtr->numElements <= (vectorPtr->capacity) / 4 && vectorPtr->capacity > vectorPtr->inlineCapacity ) {
+		resizeVector(vectorPtr, vectorPtr->capacity / 2);
 	}
 
 	return;
@@ -314,6 +816,10 @@ void removeCoursePtrFromVector(Vector *vectPtr, char *courseName) {
 				"pointer argument\n", courseName);
 		return;
 	}
+	// a sorted Vector without the Course is left alone
+	if (vectPtr->sortedCourses != NULL && findCoursePtrInVector(vectPtr, courseName) == NULL) {
+		return;
+	}
 
 	// looping through Elements in contiguous memory of Vector
 	for (int i = 0; i < vectPtr->numElements; i++) {
@@ -324,24 +830,106 @@ void removeCoursePtrFromVector(Vector *vectPtr, char *courseName) {
 			if (vectPtr->elements[i].disjunct == NULL) {
 				// if not, remove Element by shifting
 				// all Vector Elements by one Element
+				// and check the shifted Element at i
 				removeElementFromVector(vectPtr, i);
+				i--;
+				continue;
 			} else {
 				// if so, simply overwrite the Vector
 				// Element with the data of the first
 				// disjunct Element
-				overwriteHeadElementOfDisjunctList(vectPtr->elements+i);
+				overwriteHeadElementOfDisjunctList(vectPtr, vectPtr->elements+i);
 			}
 		}
 		// Vector Element's Course name is not courseName
 		// checking all of the Vector Element's disjunct Elements
-		if (vectPtr->elements+i != NULL) {
-			removeElementFromDisjunctList(vectPtr->elements+i, courseName);
-		}
+		removeElementFromDisjunctList(vectPtr, vectPtr->elements+i, courseName);
 	}
+	vectPtr->version++;
 	return;
 }
 
 
+/*
+ * removeCoursesFromVector() takes a Vector pointer, vectPtr,
+ * and a BitSet pointer of Course ids, courseIds, as arguments
+ *
+ * removeCoursesFromVector() compacts the Vector in a single
+ * pass - each Element's disjunct list is stripped of removed
+ * Courses first (releasing them to the Vector's pool), then
+ * an Element whose own Course is removed takes the Course of
+ * its first disjunct, or is dropped if it has none, and every
+ * kept Element is copied down to the next free slot
+ *
+ * a sorted Vector's index is compacted the same way, and the
+ * capacity is then halved as many times as the shrink policy
+ * of removeElementFromVector() allows, with one reallocation
+ *
+ * returns the number of Courses removed
+ */
+unsigned int removeCoursesFromVector(Vector *vectPtr, BitSet *courseIds) {
+
+	// checking for NULL pointer arguments
+	if (vectPtr == NULL || courseIds == NULL) {
+		printf("\nCannot remove Courses from Vector "
+				"with NULL Vector or BitSet "
+				"pointer argument\n");
+		return 0;
+	}
+
+	unsigned int numRemoved = 0;
+	unsigned int numKept = 0;
+	for (unsigned int i = 0; i < vectPtr->numElements; i++) {
+		Element *headPtr = vectPtr->elements + i;
+		// stripping removed Courses from the disjunct list
+		Element *tempPtr = headPtr;
+		while (tempPtr->disjunct != NULL) {
+			if ( testBit(courseIds, tempPtr->disjunct->course->id) ) {
+				removeNextElementInDisjunctList(vectPtr, tempPtr);
+				numRemoved++;
+			} else {
+				tempPtr = tempPtr->disjunct;
+			}
+		}
+		// replacing or dropping the Element itself
+		if ( testBit(courseIds, headPtr->course->id) ) {
+			numRemoved++;
+			if (headPtr->disjunct == NULL) {
+				continue;
+			}
+			overwriteHeadElementOfDisjunctList(vectPtr, headPtr);
+		}
+		vectPtr->elements[numKept] = *headPtr;
+		numKept++;
+	}
+	if (numRemoved == 0) {
+		return 0;
+	}
+
+	// compacting the sorted index
+	if (vectPtr->sortedCourses != NULL) {
+		unsigned int numSortedKept = 0;
+		for (unsigned int i = 0; i < vectPtr->numElements; i++) {
+			Course *coursePtr = vectPtr->sortedCourses[i];
+			if ( !testBit(courseIds, coursePtr->id) ) {
+				vectPtr->sortedCourses[numSortedKept] = coursePtr;
+				numSortedKept++;
+			}
+		}
+	}
+	vectPtr->numElements = numKept;
+	vectPtr->version++;
+
+	// halving capacity while the Vector is a quarter full
+	unsigned int newCapacity = vectPtr->capacity;
+	while ( numKept <= newCapacity / 4 && newCapacity > vectPtr->inlineCapacity ) {
+		newCapacity /= 2;
+	}
+	resizeVector(vectPtr, newCapacity);
+	return numRemoved;
+}
+
+
 /*
  * printVector() takes a Vector pointer as an argument, vectorPtr
  * printVector() prints the names of all Courses referenced by the Elements
@@ -387,6 +975,14 @@ void printVector(Vector *vectorPtr) {
  * and the linked lists of Element disjuncts for an Element 
  * referring to a Course with courseName
  *
+ * a sorted Vector is searched with a binary search of its
+ * sorted index instead
+ *
+ * every Course name is pooled (see stringPool.h), so
+ * courseName is looked up in the pool once - a name that
+ * is not pooled is no Course's - and the Courses' names
+ * are then compared with the pooled name by pointer
+ *
  * if the Course with courseName is found, findCoursePtrInVector()
  * returns a Course pointer
  *
@@ -410,19 +1006,33 @@ Course* findCoursePtrInVector(Vector *vectorPtr, char *courseName) {
 		return NULL;
 	}
 
+	char *pooledName = findInternedString(courseName);
+	if (pooledName == NULL) {
+		return NULL;
+	}
+
+	// binary searching the sorted index of a sorted Vector
+	if (vectorPtr->sortedCourses != NULL) {
+		unsigned int position = findSortedPosition(vectorPtr, pooledName);
+		if ( position < vectorPtr->numElements && vectorPtr->sortedCourses[position]->name == pooledName ) {
+			return vectorPtr->sortedCourses[position];
+		}
+		return NULL;
+	}
+
 	// looping through all Vector Elements
 	for (int i = 0; i < vectorPtr->numElements; i++) {
 
 		Course *currentCoursePtr = vectorPtr->elements[i].course;	
 		// checking if the Course is found
-		if ( strcmp(currentCoursePtr->name, courseName) == 0) {
+		if (currentCoursePtr->name == pooledName) {
 			return currentCoursePtr;
 		}
 		// checking all present disjunct Elements for courseName
 		Element *disjunctPtr = vectorPtr->elements[i].disjunct;
 		while (disjunctPtr != NULL) {
 			currentCoursePtr = disjunctPtr->course;	
-			if ( strcmp(currentCoursePtr->name, courseName) == 0) {
+			if (currentCoursePtr->name == pooledName) {
 				return currentCoursePtr;
 			}
 			disjunctPtr = disjunctPtr->disjunct;
@@ -432,159 +1042,3 @@ Course* findCoursePtrInVector(Vector *vectorPtr, char *courseName) {
 	// no Course, courseName, found
 	return NULL;
 }
-
-
-
-/*
- * printDifferingCourses() takes two Vector pointers as 
- * arguments, sourcePtr and vectToCheckPtr
- *
- * prints all Courses in sourcePtr that are not in 
- * vectToCheckPtr
- *
- * returns the total number of differing Courses
- * and returns -1 for error
- */
-int printDifferingCourses(Vector *sourcePtr, Vector *vectToCheckPtr) {
-
-	// checking for NULL pointer arguments
-	if ( (sourcePtr == NULL) || (vectToCheckPtr == NULL) ) {
-
-		printf("\nCannot print differing Courses "
-				"between two Vectors with "
-				"NULL Vector pointer "
-				"argument\n");
-		return -1;
-	}
-
-	// looping through all Courses in source Vector
-	int numDifferingCourses = 0;
-	for (int i = 0; i < sourcePtr->numElements; i++) {
-		// checking to see if Vector Element does not 
-		// have disjunct (Courses)
-		Element* currElementPtr = sourcePtr->elements+i;
-		if (currElementPtr->disjunct == NULL) {
-			// print if Course not found in vectToCheck
-			if ( findCoursePtrInVector(vectToCheckPtr, currElementPtr->course->name) == NULL ) {
-				printf("%s\n", currElementPtr->course->name);
-				numDifferingCourses++;
-			}
-		// Vector Element has disjunct (Courses)
-		} else {
-			// looping through first Course and then  all 
-			// disjuncts of current Element from sourcePtr 
-			// to compare to elements in vectToCheck
-			bool courseFound = false;
-			while (currElementPtr != NULL) {
-				if ( findCoursePtrInVector(vectToCheckPtr, currElementPtr->course->name) != NULL) {
-					courseFound = true;
-					break;	
-				}
-				currElementPtr = currElementPtr->disjunct;
-			}
-			if (courseFound == false) {
-				currElementPtr = sourcePtr->elements+i;
-				printf("OR %s", currElementPtr->course->name);
-				currElementPtr = currElementPtr->disjunct;
-				numDifferingCourses++;
-				while (currElementPtr != NULL) {
-					printf(", %s", currElementPtr->course->name);
-					currElementPtr = currElementPtr->disjunct;
-					numDifferingCourses++;
-				}
-				printf("\n");
-			}
-		}
-	}
-	return numDifferingCourses;
-}
-
-/*
- * printAvailableCourses() takes two Vector pointers
- * as arguments, sourcePtr and vectToCheckPtr
- *
- * prints all Courses from vectToCheckPtr whos' 
- * prerequisite requirements have been fulfilled 
- * by Courses from sourcePtr
- */
-void printAvailableCourses(Vector *sourcePtr, Vector *vectToCheckPtr) {
-
-	// checking for NULL pointer arguments
-	if ( (sourcePtr == NULL) || (vectToCheckPtr == NULL) ) {
-
-		printf("\nCannot print available Courses "
-				"between two Vectors with "
-				"NULL Vector pointer "
-				"argument\n");
-		return;
-	}
-
-	// loop through all sourcePtr Courses
-	for (int i = 0; i < sourcePtr->numElements; i++) {
-		Element *elementPtr = sourcePtr->elements+i;
-		Course *sourceCoursePtr = elementPtr->course;
-		// Course *sourceCoursePtr = sourcePtr->elements[i].course;
-		do {
-			// check current sourcePtr Course to see if its already in vectToCheck
-			if ( findCoursePtrInVector(vectToCheckPtr, sourceCoursePtr->name) == NULL ) {
-				LinkedListNode *prereqPtr = sourceCoursePtr->firstPrereq;
-
-				// if NOT, check prerequisite structure from source Course
-				// checking if the sourse Course has a prerequisite
-				if (prereqPtr == NULL) {
-					// if Course has no prereqs and is not in vectToCheck
-					// print the name of the Course
-					printf("%s\n", sourceCoursePtr->name);
-
-				} 
-				// checking if the source Course has only one prereq
-				else if (sourceCoursePtr->firstPrereq == sourceCoursePtr->lastPrereq) {
-					// single prerequisite - checking if prereq is in vector
-					if ( findCoursePtrInVector(vectToCheckPtr, prereqPtr->name) != NULL ) {
-						printf("%s\n", sourceCoursePtr->name);
-					}
-
-				}
-				// checking if the source Course has disjunct prerequisites
-				else if ( strcmp(prereqPtr->name, "OR") == 0 ) {
-				
-					// moving past OR flag
-					prereqPtr = prereqPtr->next;
-
-					// looping through all of the source Course prereqs and
-					// checking them against vectToCheckPtr
-					while (prereqPtr != NULL) {
-						if ( findCoursePtrInVector(vectToCheckPtr, prereqPtr->name) != NULL ) {
-							// printing source Course
-							printf("%s\n", sourceCoursePtr->name);
-							// exiting while loop
-							break;
-						}
-						prereqPtr = prereqPtr->next;
-					}
-				} 
-				// source Course has conjunct prerequisites
-				// if one prereq is not in vectToCheck then skip the source Course
-				// if all prereqs are in the the vectToCheck, print the Course
-				else {
-					bool prereqsFulfilled = true;
-					while (prereqPtr != NULL) {
-						if ( findCoursePtrInVector(vectToCheckPtr, prereqPtr->name) == NULL) {
-							prereqsFulfilled = false;
-
-						}
-						prereqPtr = prereqPtr->next;
-					}
-					if (prereqsFulfilled) {
-						printf("%s\n", sourceCoursePtr->name);
-					}
-				}
-			}
-			elementPtr = elementPtr->disjunct;
-			if (elementPtr != NULL) {
-				sourceCoursePtr = elementPtr->course;
-			}
-		} while (elementPtr != NULL);
-	}	
-	return;
-}
@@ -34,12 +34,33 @@
  *	contain disjunct information for every Degree it belongs to;
  *	instead, Degree's Elements contain that information for us.
  *
+ *	Elements are built directly in a Vector's storage with
+ *	emplaceElement() - no Element is allocated on its own. 
+ *	Disjunct Elements are drawn from a pool owned by the Vector,
+ *	which hands them out of chunks of ELEMENT_CHUNK_SIZE 
+ *	Elements and reuses the ones removed from disjunct lists.
+ *	Pool Elements never move, so disjunct pointers stay valid
+ *	when the Vector's own storage is reallocated.
+ *
+ *	The first few Elements of a Vector (and of its sorted
+ *	index) are stored inline, in the same allocation as the
+ *	Vector itself. The Elements only spill to separate heap
+ *	storage when the Vector grows past its inline capacity,
+ *	and move back once it shrinks to fit again, so short
+ *	Vectors cost a single allocation. An owner can also
+ *	build its Vector inside its own allocation (see
+ *	placeVector()) - a Student does this with its completed
+ *	Courses.
+ *
  */
 
 #ifndef COURSEPTRVECTOR_H
 #define COURSEPTRVECTOR_H
 
+#include <stdbool.h>
+#include <stddef.h>
 #include "course.h"
+#include "bitSet.h"
 
 // struct for data related to each Element
 typedef struct element {
@@ -47,11 +68,49 @@ typedef struct element {
 	Course *course;
 } Element;
 
+// inline capacity of a Vector from initVector() - removals
+// never shrink a Vector below its inline capacity
+#define VECTOR_MIN_CAPACITY 10
+
+// number of disjunct Elements in each chunk of a Vector's pool
+#define ELEMENT_CHUNK_SIZE 16
+
+// struct for a chunk of a Vector's disjunct Element pool
+typedef struct elementChunk {
+	struct elementChunk *next;
+	unsigned int numUsed;
+	Element elements[ELEMENT_CHUNK_SIZE];
+} ElementChunk;
+
 // struct for data related to each Vector
+//
+// disjunctChunks is the Vector's pool of disjunct Elements
+// and freeDisjuncts is a list (linked through disjunct)
+// of pool Elements that have been removed and can be reused
+//
+// version is incremented every time an Element or disjunct
+// is added or removed, so copies built from the Vector can
+// tell when they are out of date
+//
+// sortedCourses is NULL unless the Vector is sorted (see
+// initSortedVector()) - then it holds the Vector's Course
+// pointers ordered by Course name, with room for capacity
+// Course pointers
+//
+// inlineElements holds the first inlineCapacity Elements,
+// followed (for a sorted Vector) by room for inlineCapacity
+// sorted Course pointers - elements and sortedCourses point
+// there until the Vector grows past inlineCapacity
 typedef struct vector {
+	unsigned int version;
 	unsigned int numElements;
 	unsigned int capacity;
+	unsigned int inlineCapacity;
 	Element *elements;
+	ElementChunk *disjunctChunks;
+	Element *freeDisjuncts;
+	Course **sortedCourses;
+	Element inlineElements[];
 } Vector;
 
 
@@ -63,6 +122,10 @@ typedef struct vector {
  * and a NULL disjunct Element pointer
  * returns a pointer to the new Element
  *
+ * the caller owns the new Element - Vectors build 
+ * their own Elements with emplaceElement() and 
+ * emplaceDisjunct() instead
+ *
  * coursePtr - pointer to the Course used to
  * initialize the new Element
  */
@@ -83,14 +146,109 @@ void linkDisjunct(Element* elementPtr, Element* disjunctPtr);
 
 // vector structure interface
 
-/* allocates heap space for a Vector and
+/* allocates heap space for a Vector together with
+ * inline storage for VECTOR_MIN_CAPACITY Elements and
  * initializes its data members with zero numElements,
- * ten for its capacity, and allocates heap space
- * for ten Elements and stores a pointer to the 
- * first in memory, *elements
+ * VECTOR_MIN_CAPACITY for its capacity, and a pointer
+ * to the first inline Element, *elements
+ *
+ * a Vector doubles its capacity when it is full and
+ * halves it when it is only a quarter full
  */
 Vector* initVector();
 
+/* 
+ * allocates heap space for a sorted Vector -
+ * a Vector used as a set of Courses, such as
+ * a Student's completed Courses
+ *
+ * a sorted Vector keeps its Elements in the
+ * order they are added, and also keeps an index
+ * of its Course pointers sorted by Course name,
+ * so membership is answered by binary search
+ * (see findCoursePtrInVector())
+ *
+ * Elements of a sorted Vector cannot have
+ * disjuncts
+ */
+Vector* initSortedVector();
+
+/*
+ * returns the number of bytes needed to 
+ * place a Vector with the given inline
+ * capacity in storage owned by the caller
+ *
+ * inlineCapacity - number of Elements stored
+ * inline
+ *
+ * sorted - true for a sorted Vector, which
+ * also needs room for its inline index
+ */
+size_t vectorSize(unsigned int inlineCapacity, bool sorted);
+
+/*
+ * builds an empty Vector (sorted or not) with
+ * the given inline capacity in storage owned
+ * by the caller, such as the tail of the
+ * allocation of the Vector's owner, and 
+ * returns a pointer to it
+ *
+ * the Vector must not be moved, and is
+ * released with releaseVector() before its
+ * storage is freed - not with freeVector()
+ *
+ * storage - at least vectorSize() bytes,
+ * aligned for a pointer
+ *
+ * inlineCapacity - number of Elements stored
+ * inline, at least one - the same number
+ * storage was sized with
+ *
+ * sorted - true to build a sorted Vector
+ */
+Vector* placeVector(void* storage, unsigned int inlineCapacity, bool sorted);
+
+/*
+ * grows a Vector's capacity, in one step, so
+ * that it can hold at least minCapacity 
+ * Elements - for callers that know how many
+ * Elements they are about to add
+ *
+ * vectorPtr - pointer to the Vector to grow
+ *
+ * minCapacity - number of Elements the Vector
+ * must have room for
+ */
+void reserveVector(Vector* vectorPtr, unsigned int minCapacity);
+
+/*
+ * reduces a Vector's capacity to its number
+ * of Elements (but not below its inline
+ * capacity), releasing unused space
+ *
+ * vectorPtr - pointer to the Vector to shrink
+ */
+void shrinkVectorToFit(Vector* vectorPtr);
+
+/*
+ * frees a Vector, its Elements, and its
+ * pool of disjunct Elements
+ *
+ * vectorPtr - pointer to the Vector to free
+ */
+void freeVector(Vector* vectorPtr);
+
+/*
+ * frees the heap storage a Vector has 
+ * spilled to and its pool of disjunct 
+ * Elements, but not the Vector itself -
+ * for Vectors built with placeVector()
+ *
+ * vectorPtr - pointer to the Vector to
+ * release
+ */
+void releaseVector(Vector* vectorPtr);
+
 /*
  * adds an Element to a Vector, updates the 
  * Vector's numElements data member and 
@@ -98,6 +256,9 @@ Vector* initVector();
  * all Elements can be accessed through
  * the Vector's *elements data member
  *
+ * the Element is copied into the Vector -
+ * the caller still owns elementPtr
+ *
  * vectorPtr - pointer to the Vector to which 
  * the new Element is added
  *
@@ -106,6 +267,61 @@ Vector* initVector();
  */ 
 void addElement(Vector* vectorPtr, Element* elementPtr);
 
+/*
+ * builds a new Element with the given Course
+ * pointer (and no disjunct) directly in the
+ * Vector's storage, updates the Vector's
+ * numElements and increases capacity as
+ * necessary
+ *
+ * returns a pointer to the new Element - 
+ * the pointer is only valid until the Vector
+ * is next added to or removed from
+ *
+ * vectorPtr - pointer to the Vector to which 
+ * the new Element is added
+ *
+ * coursePtr - pointer to the Course the new
+ * Element refers to
+ */
+Element* emplaceElement(Vector* vectorPtr, Course* coursePtr);
+
+/*
+ * builds one Element (with no disjunct) per
+ * Course in the given array at the end of the
+ * Vector, reserving space for all of them first
+ *
+ * vectorPtr - pointer to the Vector to which
+ * the new Elements are added
+ *
+ * courses - array of pointers to the Courses
+ * the new Elements refer to, in order
+ *
+ * numCourses - number of Courses in courses
+ */
+void emplaceElements(Vector* vectorPtr, Course** courses, unsigned int numCourses);
+
+/*
+ * takes a disjunct Element for the given Course
+ * pointer from the Vector's pool and links it
+ * as the disjunct of the given Element
+ *
+ * returns a pointer to the new disjunct Element,
+ * which keeps its address for the life of the
+ * Vector
+ *
+ * vectorPtr - pointer to the Vector that owns
+ * elementPtr's disjunct list
+ *
+ * elementPtr - pointer to the Element (in the
+ * Vector or in its disjunct list) to attach
+ * the new disjunct to
+ *
+ * coursePtr - pointer to the Course the new
+ * disjunct Element refers to
+ */
+Element* emplaceDisjunct(Vector* vectorPtr, Element* elementPtr, Course* coursePtr);
+
 /*
  * removes a Course pointer and its associated
  * Element with given Course name from every 
@@ -120,6 +336,25 @@ void addElement(Vector* vectorPtr, Element* elementPtr);
  */
 void removeCoursePtrFromVector(Vector* vectPtr, char* courseName);
 
+/*
+ * removes every Course whose id is set in the
+ * given BitSet from a Vector in one pass,
+ * including Courses in disjunct Element linked
+ * lists, and returns the number of Courses
+ * removed
+ *
+ * an Element whose own Course is removed is
+ * replaced by its first remaining disjunct, if
+ * it has one
+ *
+ * vectPtr - pointer to the Vector we remove
+ * Courses from
+ *
+ * courseIds - pointer to the BitSet of the
+ * ids of the Courses to remove
+ */
+unsigned int removeCoursesFromVector(Vector* vectPtr, BitSet* courseIds);
+
 /*
  * prints the names of all Courses referenced
  * by the Elements of the given Vector, including
@@ -136,6 +371,9 @@ void printVector(Vector* vectorPtr);
  * to the Course with the Course name argument,
  * if there is one
  * otherwise, returns NULL
+ *
+ * a sorted Vector is binary searched, any other
+ * Vector is scanned Element by Element
  * 
  * vectorPtr - pointer to the Vector which is
  * searched
@@ -145,33 +383,4 @@ void printVector(Vector* vectorPtr);
  */ 
 Course* findCoursePtrInVector(Vector* vectorPtr, char* courseName);
 
-/*
- * prints all Courses in the first Vector that 
- * are not in the other Vector
- *
- * sourcePtr - pointer to the Vector we 
- * loop through to check against the Courses
- * in vectToCheckPtr - the Courses we print
- * if not found in vectToCheckPtr
- *
- * vectToCheckPtr - pointer to the Vector whose
- * Courses we check against
- */
-int printDifferingCourses(Vector* sourcePtr, Vector* vectToCheckPtr);
-
-/*
- * prints all Courses from the second Vector
- * whos' prerequisite requirements have been 
- * fulfilled by Courses from the first Vector
- *
- * sourcePtr - pointer to the Vector whose 
- * Courses we loop through to check against the 
- * prerequisites in vectToCheckPtr
- *
- * vectToCheckPtr - pointer to the Vector whose
- * prerequisite requirements we check for
- * completion
- */
-void printAvailableCourses(Vector* sourcePtr, Vector* vectToCheckPtr);
-
 #endif
@@ -0,0 +1,287 @@
+/*
+ *
+ *	C source file containing the implementation of
+ *	the course set operations over Vectors
+ *
+ *	Go to header file for more information
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "courseSet.h"
+
+/*
+ * countVectorCourses() takes a Vector pointer as an
+ * argument and returns the number of Courses in the
+ * Vector, including disjunct Courses
+ */
+unsigned int countVectorCourses(Vector *vectorPtr) {
+
+	unsigned int numCourses = 0;
+	for (unsigned int i = 0; i < vectorPtr->numElements; i++) {
+		Element *elementPtr = vectorPtr->elements + i;
+		while (elementPtr != NULL) {
+			numCourses++;
+			elementPtr = elementPtr->disjunct;
+		}
+	}
+	return numCourses;
+}
+
+/*
+ * markCourseIds() takes a BitSet pointer and a Vector
+ * pointer as arguments and sets the id of every Course
+ * in the Vector, including disjunct Courses, in the
+ * BitSet
+ */
+void markCourseIds(BitSet *marksPtr, Vector *vectorPtr) {
+
+	for (unsigned int i = 0; i < vectorPtr->numElements; i++) {
+		Element *elementPtr = vectorPtr->elements + i;
+		while (elementPtr != NULL) {
+			setBit(marksPtr, elementPtr->course->id);
+			elementPtr = elementPtr->disjunct;
+		}
+	}
+	return;
+}
+
+/*
+ * gatherCourses() takes a Vector pointer, a BitSet pointer
+ * of marked Course ids (or NULL), whether marked or unmarked
+ * Courses are kept, a BitSet pointer of Course ids already
+ * gathered, an array to gather Courses into, and a pointer
+ * to the number of Courses in the array as arguments
+ *
+ * gatherCourses() makes one pass over the Vector's Courses
+ * and appends each Course that is kept and not yet gathered
+ * to the array - with no marks, every Course is kept
+ */
+void gatherCourses(Vector *vectorPtr, BitSet *marksPtr, bool keepMarked, BitSet *seenPtr, Course **courses, unsigned int *numCourses) {
+
+	for (unsigned int i = 0; i < vectorPtr->numElements; i++) {
+		Element *elementPtr = vectorPtr->elements + i;
+		while (elementPtr != NULL) {
+			Course *coursePtr = elementPtr->course;
+			elementPtr = elementPtr->disjunct;
+			if ( marksPtr != NULL && testBit(marksPtr, coursePtr->id) != keepMarked ) {
+				continue;
+			}
+			if ( testBit(seenPtr, coursePtr->id) ) {
+				continue;
+			}
+			setBit(seenPtr, coursePtr->id);
+			courses[*numCourses] = coursePtr;
+			(*numCourses)++;
+		}
+	}
+	return;
+}
+
+/*
+ * filterCourseSet() takes two Vector pointers and whether
+ * the Courses of the first Vector that are in the second
+ * (true) or not in the second (false) are kept
+ *
+ * filterCourseSet() marks the second Vector's Course ids
+ * and gathers the kept Courses of the first Vector into
+ * a new sorted Vector
+ */
+Vector* filterCourseSet(Vector *firstPtr, Vector *secondPtr, bool keepMarked) {
+
+	BitSet *marksPtr = initBitSet(0);
+	BitSet *seenPtr = initBitSet(0);
+	markCourseIds(marksPtr, secondPtr);
+
+	Course **courses = (Course**) malloc( (countVectorCourses(firstPtr) + 1) * sizeof(Course*) );
+	unsigned int numCourses = 0;
+	gatherCourses(firstPtr, marksPtr, keepMarked, seenPtr, courses, &numCourses);
+
+	Vector *resultPtr = initSortedVector();
+	emplaceElements(resultPtr, courses, numCourses);
+	free(courses);
+	freeBitSet(marksPtr);
+	freeBitSet(seenPtr);
+	return resultPtr;
+}
+
+/*
+ * courseSetDifference() takes two Vector pointers as
+ * arguments and returns a new sorted Vector of the
+ * Courses in firstPtr that are not in secondPtr
+ *
+ * returns NULL for error
+ */
+Vector* courseSetDifference(Vector *firstPtr, Vector *secondPtr) {
+
+	// checking for NULL pointer arguments
+	if (firstPtr == NULL || secondPtr == NULL) {
+		printf("\nCannot take the difference of "
+				"two Vectors with NULL "
+				"Vector pointer "
+				"argument\n");
+		return NULL;
+	}
+	return filterCourseSet(firstPtr, secondPtr, false);
+}
+
+/*
+ * courseSetIntersection() takes two Vector pointers as
+ * arguments and returns a new sorted Vector of the
+ * Courses in both firstPtr and secondPtr
+ *
+ * returns NULL for error
+ */
+Vector* courseSetIntersection(Vector *firstPtr, Vector *secondPtr) {
+
+	// checking for NULL pointer arguments
+	if (firstPtr == NULL || secondPtr == NULL) {
+		printf("\nCannot take the intersection of "
+				"two Vectors with NULL "
+				"Vector pointer "
+				"argument\n");
+		return NULL;
+	}
+	return filterCourseSet(firstPtr, secondPtr, true);
+}
+
+/*
+ * courseSetUnion() takes two Vector pointers as arguments
+ * and returns a new sorted Vector of the Courses in
+ * firstPtr followed by the Courses in secondPtr that
+ * are not in firstPtr
+ *
+ * returns NULL for error
+ */
+Vector* courseSetUnion(Vector *firstPtr, Vector *secondPtr) {
+
+	// checking for NULL pointer arguments
+	if (firstPtr == NULL || secondPtr == NULL) {
+		printf("\nCannot take the union of "
+				"two Vectors with NULL "
+				"Vector pointer "
+				"argument\n");
+		return NULL;
+	}
+
+	BitSet *seenPtr = initBitSet(0);
+	unsigned int maxCourses = countVectorCourses(firstPtr) + countVectorCourses(secondPtr);
+	Course **courses = (Course**) malloc( (maxCourses + 1) * sizeof(Course*) );
+	unsigned int numCourses = 0;
+	gatherCourses(firstPtr, NULL, false, seenPtr, courses, &numCourses);
+	gatherCourses(secondPtr, NULL, false, seenPtr, courses, &numCourses);
+
+	Vector *resultPtr = initSortedVector();
+	emplaceElements(resultPtr, courses, numCourses);
+	free(courses);
+	freeBitSet(seenPtr);
+	return resultPtr;
+}
+
+/*
+ * courseSetContains() takes two Vector pointers as
+ * arguments and returns true if every Course in
+ * secondPtr is also in firstPtr
+ *
+ * returns false for error
+ */
+bool courseSetContains(Vector *firstPtr, Vector *secondPtr) {
+
+	// checking for NULL pointer arguments
+	if (firstPtr == NULL || secondPtr == NULL) {
+		printf("\nCannot check if a Vector contains "
+				"another with NULL Vector "
+				"pointer argument\n");
+		return false;
+	}
+
+	BitSet *marksPtr = initBitSet(0);
+	markCourseIds(marksPtr, firstPtr);
+	bool contained = true;
+	for (unsigned int i = 0; i < secondPtr->numElements && contained; i++) {
+		Element *elementPtr = secondPtr->elements + i;
+		while (elementPtr != NULL) {
+			if ( !testBit(marksPtr, elementPtr->course->id) ) {
+				contained = false;
+				break;
+			}
+			elementPtr = elementPtr->disjunct;
+		}
+	}
+	freeBitSet(marksPtr);
+	return contained;
+}
+
+/*
+ * requirementDifference() takes a RequirementGroups pointer
+ * and a BitSet pointer of completed Course ids as arguments
+ *
+ * requirementDifference() builds a new Vector with one
+ * Element for every group that is not fulfilled - the
+ * group's first Course, with the rest of the group's
+ * Courses linked as its disjuncts
+ *
+ * returns NULL for error
+ */
+Vector* requirementDifference(RequirementGroups *groupsPtr, BitSet *completedPtr) {
+
+	// checking for NULL pointer arguments
+	if (groupsPtr == NULL || completedPtr == NULL) {
+		printf("\nCannot take the difference of "
+				"requirements with NULL "
+				"RequirementGroups or BitSet "
+				"pointer argument\n");
+		return NULL;
+	}
+
+	Vector *resultPtr = initVector();
+	for (unsigned int i = 0; i < groupsPtr->numGroups; i++) {
+		if ( isRequirementFulfilled(groupsPtr, i, completedPtr) ) {
+			continue;
+		}
+		RequirementGroup group = groupsPtr->groups[i];
+		Course **courses = groupsPtr->courses + group.offset;
+		Element *lastElementPtr = emplaceElement(resultPtr, courses[0]);
+		for (unsigned int j = 1; j < group.count; j++) {
+			lastElementPtr = emplaceDisjunct(resultPtr, lastElementPtr, courses[j]);
+		}
+	}
+	return resultPtr;
+}
+
+/*
+ * requirementsInSet() takes a RequirementGroups pointer
+ * and a BitSet pointer of Course ids as arguments
+ *
+ * requirementsInSet() walks the groups' Course array in
+ * order and gathers every Course whose id is in the
+ * BitSet into a new Vector
+ *
+ * returns NULL for error
+ */
+Vector* requirementsInSet(RequirementGroups *groupsPtr, BitSet *courseIds) {
+
+	// checking for NULL pointer arguments
+	if (groupsPtr == NULL || courseIds == NULL) {
+		printf("\nCannot find requirements in a "
+				"set with NULL RequirementGroups "
+				"or BitSet pointer argument\n");
+		return NULL;
+	}
+
+	Course **courses = (Course**) malloc( (groupsPtr->numCourses + 1) * sizeof(Course*) );
+	unsigned int numCourses = 0;
+	for (unsigned int i = 0; i < groupsPtr->numCourses; i++) {
+		if ( testBit(courseIds, groupsPtr->courseIds[i]) ) {
+			courses[numCourses] = groupsPtr->courses[i];
+			numCourses++;
+		}
+	}
+
+	Vector *resultPtr = initVector();
+	emplaceElements(resultPtr, courses, numCourses);
+	free(courses);
+	return resultPtr;
+}
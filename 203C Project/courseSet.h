@@ -0,0 +1,113 @@
+/*
+ *
+ *	Header file for the course set operation interface
+ *
+ *	These functions treat Vectors of Elements as sets of
+ *	Courses and build a new Vector for the result of a
+ *	set operation instead of printing as they go. Every
+ *	Course of a Vector counts as a member - both the
+ *	Elements' Courses and their disjunct Courses.
+ *
+ *	Each operation marks the Course ids of one Vector in
+ *	a BitSet and then makes a single pass over the other
+ *	Vector, so it takes time linear in the sizes of the
+ *	two Vectors rather than one search per Course.
+ *
+ *	Results of the plain set operations are sorted
+ *	Vectors (see initSortedVector()) with the Courses in
+ *	the order they were first found.
+ *
+ *	The disjunct-aware operations work on a Degree's
+ *	RequirementGroups (see requirementGroups.h), where
+ *	a whole disjunct group is fulfilled by any one of its
+ *	Courses, and return Vectors that print with
+ *	printVector().
+ *
+ *	The caller owns every returned Vector and frees it
+ *	with freeVector().
+ *
+ */
+
+#ifndef COURSESET_H
+#define COURSESET_H
+
+#include "coursePtrVector.h"
+#include "requirementGroups.h"
+#include "bitSet.h"
+
+// course set interface
+
+/*
+ * returns a new Vector of the Courses in
+ * the first Vector that are not in the
+ * second Vector
+ *
+ * firstPtr - pointer to the Vector whose
+ * Courses are kept
+ *
+ * secondPtr - pointer to the Vector whose
+ * Courses are taken away
+ */
+Vector* courseSetDifference(Vector* firstPtr, Vector* secondPtr);
+
+/*
+ * returns a new Vector of the Courses in
+ * both Vectors
+ *
+ * firstPtr - pointer to the first Vector
+ *
+ * secondPtr - pointer to the second Vector
+ */
+Vector* courseSetIntersection(Vector* firstPtr, Vector* secondPtr);
+
+/*
+ * returns a new Vector of the Courses in
+ * either Vector, each Course once - the
+ * first Vector's Courses come first
+ *
+ * firstPtr - pointer to the first Vector
+ *
+ * secondPtr - pointer to the second Vector
+ */
+Vector* courseSetUnion(Vector* firstPtr, Vector* secondPtr);
+
+/*
+ * returns true if every Course in the
+ * second Vector is also in the first
+ *
+ * firstPtr - pointer to the Vector that
+ * may contain the other
+ *
+ * secondPtr - pointer to the Vector that
+ * may be contained
+ */
+bool courseSetContains(Vector* firstPtr, Vector* secondPtr);
+
+/*
+ * returns a new Vector with one Element
+ * (and its disjuncts) for every requirement
+ * group that the completed Course ids do not
+ * fulfill, in the order of the groups
+ *
+ * groupsPtr - pointer to the Degree's
+ * RequirementGroups
+ *
+ * completedPtr - pointer to the BitSet of
+ * completed Course ids
+ */
+Vector* requirementDifference(RequirementGroups* groupsPtr, BitSet* completedPtr);
+
+/*
+ * returns a new Vector of every Course of
+ * the requirement groups, in order, whose
+ * id is in the BitSet
+ *
+ * groupsPtr - pointer to the Degree's
+ * RequirementGroups
+ *
+ * courseIds - pointer to the BitSet of
+ * Course ids to keep
+ */
+Vector* requirementsInSet(RequirementGroups* groupsPtr, BitSet* courseIds);
+
+#endif
@@ -0,0 +1,141 @@
+/*
+ *
+ *	C source file for the course set benchmark
+ *
+ *	Builds two Vectors of n Courses each, drawn at
+ *	random from a CourseBinaryTree of 3n Courses, and
+ *	times the difference of the two three ways - one
+ *	findCoursePtrInVector() per Course on an unsorted
+ *	Vector, the same on a sorted Vector, and
+ *	courseSetDifference() (building its result Vector
+ *	included) - and then each of the other course set
+ *	operations
+ *
+ *	Build with "make bench" and run as
+ *	./courseSetBench [n ...] - n is 50, 500, and 5000
+ *	when no sizes are given
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "courseBT.h"
+#include "courseSet.h"
+
+// Course lookups timed for every size, so that each
+// size takes about as long
+#define BENCH_LOOKUPS 2000000
+
+/*
+ * secondsNow() returns the time of the monotonic
+ * clock in seconds
+ */
+double secondsNow() {
+
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+/*
+ * benchCourseSets() takes the number of Courses, n, of
+ * each Vector as an argument, times the course set
+ * operations on two Vectors of n Courses, and prints
+ * the microseconds per call of each
+ */
+void benchCourseSets(unsigned int n) {
+
+	// the Courses the Vectors are drawn from
+	CourseBinaryTree *bt = createCourseBinaryTree();
+	Course **courses = (Course**) malloc(3 * n * sizeof(Course*));
+	char courseName[16];
+	for (unsigned int i = 0; i < 3 * n; i++) {
+		sprintf(courseName, "C%07d", rand() % 10000000);
+		courses[i] = insertInCourseBinaryTree(bt, courseName);
+	}
+
+	Vector *firstPtr = initVector();
+	Vector *secondPtr = initVector();
+	Vector *sortedSecondPtr = initSortedVector();
+	for (unsigned int i = 0; i < n; i++) {
+		emplaceElement(firstPtr, courses[rand() % (3 * n)]);
+		Course *coursePtr = courses[rand() % (3 * n)];
+		emplaceElement(secondPtr, coursePtr);
+		emplaceElement(sortedSecondPtr, coursePtr);
+	}
+
+	// the sums keep the compiler from dropping the calls
+	unsigned int rounds = BENCH_LOOKUPS / n + 1;
+	unsigned long total = 0;
+	double start = secondsNow();
+	for (unsigned int r = 0; r < rounds; r++) {
+		for (unsigned int i = 0; i < n; i++) {
+			total += findCoursePtrInVector(secondPtr, firstPtr->elements[i].course->name) == NULL;
+		}
+	}
+	double scanTime = secondsNow() - start;
+
+	start = secondsNow();
+	for (unsigned int r = 0; r < rounds; r++) {
+		for (unsigned int i = 0; i < n; i++) {
+			total += findCoursePtrInVector(sortedSecondPtr, firstPtr->elements[i].course->name) == NULL;
+		}
+	}
+	double sortedScanTime = secondsNow() - start;
+
+	double operationTimes[4];
+	for (unsigned int op = 0; op < 4; op++) {
+		start = secondsNow();
+		for (unsigned int r = 0; r < rounds; r++) {
+			Vector *resultPtr = NULL;
+			switch (op) {
+				case 0: resultPtr = courseSetDifference(firstPtr, secondPtr); break;
+				case 1: resultPtr = courseSetIntersection(firstPtr, secondPtr); break;
+				case 2: resultPtr = courseSetUnion(firstPtr, secondPtr); break;
+				case 3: total += courseSetContains(firstPtr, secondPtr); break;
+			}
+			if (resultPtr != NULL) {
+				total += resultPtr->numElements;
+				freeVector(resultPtr);
+			}
+		}
+		operationTimes[op] = secondsNow() - start;
+	}
+
+	printf("n=%5u  scan %9.2f us  sorted scan %8.2f us  "
+			"difference %8.2f us  intersection %8.2f us  "
+			"union %8.2f us  contains %8.2f us  (%lu)\n",
+			n, scanTime / rounds * 1e6, sortedScanTime / rounds * 1e6,
+			operationTimes[0] / rounds * 1e6, operationTimes[1] / rounds * 1e6,
+			operationTimes[2] / rounds * 1e6, operationTimes[3] / rounds * 1e6,
+			total);
+
+	freeVector(firstPtr);
+	freeVector(secondPtr);
+	freeVector(sortedSecondPtr);
+	free(courses);
+	return;
+}
+
+int main(int argc, char *argv[]) {
+
+	srand(5);
+	if (argc < 2) {
+		benchCourseSets(50);
+		benchCourseSets(500);
+		benchCourseSets(5000);
+		return 0;
+	}
+	for (int i = 1; i < argc; i++) {
+		int n = atoi(argv[i]);
+		if (n <= 0) {
+			printf("\nCannot benchmark course sets of "
+					"%s Courses\n", argv[i]);
+			continue;
+		}
+		benchCourseSets(n);
+	}
+	return 0;
+}
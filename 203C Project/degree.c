@@ -26,6 +26,7 @@
 
 #include "degree.h"
 #include "stringFunctions.h"
+#include "stringPool.h"
 
 /*
  * initDegree() takes the Degree's name as a string argument
@@ -46,11 +47,42 @@ Degree* initDegree(char *degName) {
 	// allocating space on the heap
 	Degree *degPtr = (Degree*) malloc(sizeof(Degree));
 	// filling in data members
-	degPtr->name = degName;
+	degPtr->name = internString(degName);
 	degPtr->reqCourses = initVector();
+	degPtr->reqGroups = initRequirementGroups();
 	return degPtr;
 }
 
+/*
+ * getDegreeRequirementGroups() takes a Degree pointer
+ * as an argument
+ *
+ * if the version of the Degree's Vector of required
+ * Courses matches the version the Degree's 
+ * RequirementGroups were built from, the groups are
+ * returned as they are
+ *
+ * otherwise, the Vector is flattened again first
+ *
+ * returns NULL for error
+ */
+RequirementGroups* getDegreeRequirementGroups(Degree *degreePtr) {
+
+	// checking for NULL pointer argument
+	if (degreePtr == NULL) {
+		printf("\nCannot get requirement groups "
+				"with NULL Degree pointer "
+				"argument\n");
+		return NULL;
+	}
+
+	// flattening (again) if the requirements changed
+	if (degreePtr->reqGroups->vectorVersion != degreePtr->reqCourses->version) {
+		flattenRequirements(degreePtr->reqGroups, degreePtr->reqCourses);
+	}
+	return degreePtr->reqGroups;
+}
+
 /*
  * addDegreeCourse() takes a Degree pointer, degreePtr, and an
  * Element pointer, elementPtr, as arguments
@@ -132,7 +164,12 @@ Degree* loadDegree(char **lines, int numLinesInFile, CourseBinaryTree *courseTre
 		return NULL;
 	}
 
+	// the Degree's name line is pooled, as every required
+	// Course keeps it too
+	lines[1] = internHeapString(lines[1]);
 	Degree *degPtr = initDegree(lines[1]);
+	// each remaining line is at most one requirement
+	reserveVector(degPtr->reqCourses, numLinesInFile - 2);
 	// going through the array of strings from the file  
 	for (int j = 2; j < numLinesInFile; ++j) {
 		// ignore empty line
@@ -141,8 +178,9 @@ Degree* loadDegree(char **lines, int numLinesInFile, CourseBinaryTree *courseTre
 			char **courseStringsArr = NULL;
 			int numStrings = splitStringAtComma(lines[j], &courseStringsArr);
 			// loading degree courses into course tree and
-			// course pointers into degree struct
-			Element* firstCourseAdded = NULL;
+			// course pointers into degree struct - the first
+			// Course is built in the Degree's Vector and each
+			// alternative comes from the Vector's disjunct pool
 			Element* lastCourseAdded = NULL;
 			int i = 0;
 			if ( strcmp(courseStringsArr[0], "OR") == 0 ) {
@@ -153,18 +191,13 @@ Degree* loadDegree(char **lines, int numLinesInFile, CourseBinaryTree *courseTre
 				Course *coursePtr = insertInCourseBinaryTree(courseTreePtr, courseStringsArr[i]);
 				// degree name into course struct
 				appendDegreeToCourse(coursePtr, lines[1]);
-				Element* newDegreeCourse = initElement(coursePtr);
-				if (i <= 1) {
-					firstCourseAdded = newDegreeCourse;
-				}
-				if (i > 1) {
-					linkDisjunct(lastCourseAdded, newDegreeCourse);
+				if (lastCourseAdded == NULL) {
+					lastCourseAdded = emplaceElement(degPtr->reqCourses, coursePtr);
+				} else {
+					lastCourseAdded = emplaceDisjunct(degPtr->reqCourses, lastCourseAdded, coursePtr);
 				}
-				lastCourseAdded = newDegreeCourse;
 				i++;
 			}
-			// putting element(s) into degree struct
-			addDegreeCourse(degPtr, firstCourseAdded);
 		}
 	}
 	return degPtr;
@@ -26,6 +26,9 @@
  *	Elements for a particular Course or by finding a Course on the 
  *	CourseBinaryTree and accessing its linked list of Degree program names
  *
+ *	For audits, each Degree also keeps its requirements flattened into
+ *	RequirementGroups (see requirementGroups.h)
+ *
  */
 
 #ifndef DEGREE_H
@@ -33,11 +36,17 @@
 
 #include "coursePtrVector.h"
 #include "courseBT.h"
+#include "requirementGroups.h"
 
 // struct for data related to a degree program
+//
+// reqGroups is a flat copy of reqCourses for audits,
+// rebuilt by getDegreeRequirementGroups() whenever
+// reqCourses has changed
 typedef struct degree {
 	char *name;
 	Vector *reqCourses;
+	RequirementGroups *reqGroups;
 } Degree;
 
 
@@ -78,6 +87,17 @@ Degree* initDegree(char* degName);
 void addDegreeCourse(Degree* degreePtr, Element* elementPtr);
 
 
+/*
+ * returns the Degree's requirements as
+ * flat RequirementGroups, flattening the
+ * Degree's Vector first if it has changed
+ * since the groups were last built
+ *
+ * degreePtr - pointer to the Degree whose
+ * requirement groups we want
+ */
+RequirementGroups* getDegreeRequirementGroups(Degree* degreePtr);
+
 /*
  * takes an array of lines from a Degree
  * file and adds each Course name
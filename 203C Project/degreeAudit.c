@@ -0,0 +1,542 @@
+/*
+ *
+ *	C source file containing the implementation of
+ *	the DegreeAudit ADT
+ *
+ *	Go to header file for more information
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "degreeAudit.h"
+
+// struct for the range of Students one thread audits -
+// shared is read by every thread, result is only
+// written by the range's own thread
+typedef struct auditRange {
+	void *shared;
+	void *result;
+	unsigned int first;
+	unsigned int last;
+} AuditRange;
+
+// struct for what every thread of a ranking reads
+typedef struct rankingShared {
+	Student **students;
+	Degree *degreeFilter;
+	unsigned int k;
+} RankingShared;
+
+// struct for the bounded heap of one thread of a
+// ranking - the farthest from graduating is on top
+typedef struct rankingHeap {
+	unsigned int numAudited;
+	unsigned int numCandidates;
+	GraduationCandidate *candidates;
+} RankingHeap;
+
+/*
+ * auditStudent() takes a StudentAudit pointer as an
+ * argument and fills in the indices of the Student's
+ * unfulfilled requirement groups
+ *
+ * only the Student's own completed set is changed, so
+ * Students can be audited on different threads
+ */
+void auditStudent(StudentAudit *auditPtr) {
+
+	auditPtr->numMissing = 0;
+	auditPtr->missingGroups = NULL;
+	if (auditPtr->degreePtr == NULL) {
+		return;
+	}
+
+	// the groups were flattened before any thread started
+	RequirementGroups *groupsPtr = auditPtr->degreePtr->reqGroups;
+	BitSet *completedSet = getStudentCompletedSet(auditPtr->studentPtr);
+	unsigned int *missingGroups = (unsigned int*) malloc( (groupsPtr->numGroups + 1) * sizeof(unsigned int) );
+	auditPtr->numMissing = findUnfulfilledGroups(groupsPtr, completedSet, missingGroups);
+	auditPtr->missingGroups = missingGroups;
+	return;
+}
+
+/*
+ * auditRangeOfStudents() takes an AuditRange pointer as
+ * its argument, in the form pthread_create() expects,
+ * audits each Student of the range, and returns NULL
+ */
+void* auditRangeOfStudents(void *rangeArg) {
+
+	AuditRange *rangePtr = (AuditRange*) rangeArg;
+	StudentAudit *audits = (StudentAudit*) rangePtr->result;
+	for (unsigned int i = rangePtr->first; i < rangePtr->last; i++) {
+		auditStudent(audits + i);
+	}
+	return NULL;
+}
+
+/*
+ * countAuditThreads() takes a number of Students as an
+ * argument and returns the number of threads to audit
+ * them on - one per online processor, with at least
+ * AUDIT_STUDENTS_PER_THREAD Students each, and never
+ * fewer than one
+ */
+unsigned int countAuditThreads(unsigned int numStudents) {
+
+	long numProcessors = sysconf(_SC_NPROCESSORS_ONLN);
+	unsigned int numThreads = (numProcessors > 0) ? (unsigned int) numProcessors : 1;
+	unsigned int maxThreads = (numStudents + AUDIT_STUDENTS_PER_THREAD - 1) / AUDIT_STUDENTS_PER_THREAD;
+	if (numThreads > maxThreads) {
+		numThreads = maxThreads;
+	}
+	if (numThreads == 0) {
+		numThreads = 1;
+	}
+	return numThreads;
+}
+
+/*
+ * runAuditRanges() takes an array of AuditRanges, the
+ * number of ranges (one per thread), the number of
+ * Students, and the function that handles one range as
+ * arguments
+ *
+ * runAuditRanges() splits the Students into one
+ * contiguous range per AuditRange, starts a thread for
+ * every range but the first, handles the first range on
+ * the calling thread, and waits for all of the threads -
+ * a range whose thread cannot be started is handled by
+ * the calling thread instead
+ */
+void runAuditRanges(AuditRange *ranges, unsigned int numThreads, unsigned int numStudents, void* (*rangeFunction)(void*)) {
+
+	pthread_t *threads = (pthread_t*) malloc(numThreads * sizeof(pthread_t));
+	bool *started = (bool*) calloc(numThreads, sizeof(bool));
+	for (unsigned int t = 0; t < numThreads; t++) {
+		ranges[t].first = (unsigned int) ( (unsigned long) numStudents * t / numThreads );
+		ranges[t].last = (unsigned int) ( (unsigned long) numStudents * (t + 1) / numThreads );
+		// the calling thread takes the first range itself
+		if (t > 0) {
+			started[t] = ( pthread_create(threads + t, NULL, rangeFunction, ranges + t) == 0 );
+		}
+	}
+	rangeFunction(ranges);
+	for (unsigned int t = 1; t < numThreads; t++) {
+		if (started[t]) {
+			pthread_join(threads[t], NULL);
+		} else {
+			rangeFunction(ranges + t);
+		}
+	}
+
+	free(threads);
+	free(started);
+	return;
+}
+
+/*
+ * runDegreeAudit() takes an array of Student pointers, the
+ * number of Students, and a DegreeVector pointer as
+ * arguments
+ *
+ * runDegreeAudit() resolves every Student's Degree and
+ * flattens every Degree's requirements first, then
+ * audits the Students in one range per thread (see
+ * runAuditRanges())
+ *
+ * returns NULL for error
+ */
+DegreeAudit* runDegreeAudit(Student **students, unsigned int numStudents, DegreeVector *degListPtr) {
+
+	// checking for NULL pointer arguments
+	if ( (students == NULL && numStudents > 0) || degListPtr == NULL ) {
+		printf("\nCannot run a DegreeAudit with "
+				"NULL Student array or "
+				"DegreeVector pointer "
+				"argument\n");
+		return NULL;
+	}
+
+	// allocating heap space
+	DegreeAudit *auditPtr = (DegreeAudit*) malloc(sizeof(DegreeAudit));
+	// filling in data members
+	auditPtr->numStudents = numStudents;
+	auditPtr->audits = (StudentAudit*) calloc(numStudents + 1, sizeof(StudentAudit));
+
+	// making everything the threads share current
+	for (unsigned int i = 0; i < numStudents; i++) {
+		StudentAudit *studentAuditPtr = auditPtr->audits + i;
+		studentAuditPtr->studentPtr = students[i];
+		studentAuditPtr->degreePtr = getStudentDegree(students[i], degListPtr);
+		if (studentAuditPtr->degreePtr != NULL) {
+			getDegreeRequirementGroups(studentAuditPtr->degreePtr);
+		}
+	}
+
+	unsigned int numThreads = countAuditThreads(numStudents);
+	auditPtr->numThreads = numThreads;
+	AuditRange *ranges = (AuditRange*) malloc(numThreads * sizeof(AuditRange));
+	for (unsigned int t = 0; t < numThreads; t++) {
+		ranges[t].shared = NULL;
+		ranges[t].result = auditPtr->audits;
+	}
+	runAuditRanges(ranges, numThreads, numStudents, auditRangeOfStudents);
+	free(ranges);
+	return auditPtr;
+}
+
+/*
+ * freeDegreeAudit() takes a DegreeAudit pointer as an
+ * argument and frees every Student's results, the
+ * results array, and the DegreeAudit
+ */
+void freeDegreeAudit(DegreeAudit *auditPtr) {
+
+	if (auditPtr == NULL) {
+		return;
+	}
+	for (unsigned int i = 0; i < auditPtr->numStudents; i++) {
+		free(auditPtr->audits[i].missingGroups);
+	}
+	free(auditPtr->audits);
+	free(auditPtr);
+	return;
+}
+
+/*
+ * writeDegreeAudit() takes a DegreeAudit pointer and a
+ * FILE pointer opened for writing as arguments
+ *
+ * writeDegreeAudit() writes the header line and then one
+ * tab-separated line per Student, in the order the
+ * Students were audited
+ */
+void writeDegreeAudit(DegreeAudit *auditPtr, FILE *reportFile) {
+
+	// checking for NULL pointer arguments
+	if (auditPtr == NULL || reportFile == NULL) {
+		printf("\nCannot write a DegreeAudit with "
+				"NULL DegreeAudit or FILE "
+				"pointer argument\n");
+		return;
+	}
+
+	fprintf(reportFile, "student\tdegree\tstatus\tmissing_groups\tmissing\n");
+	for (unsigned int i = 0; i < auditPtr->numStudents; i++) {
+		StudentAudit *studentAuditPtr = auditPtr->audits + i;
+		Student *studentPtr = studentAuditPtr->studentPtr;
+		char *degreeName = (studentPtr->degree == NULL) ? "" : studentPtr->degree;
+		fprintf(reportFile, "%s\t%s\t", studentPtr->name, degreeName);
+
+		if (studentAuditPtr->degreePtr == NULL) {
+			fprintf(reportFile, "unknown degree\t\t\n");
+			continue;
+		}
+		fprintf(reportFile, "%s\t%u\t",
+				(studentAuditPtr->numMissing == 0) ? "complete" : "incomplete",
+				studentAuditPtr->numMissing);
+
+		RequirementGroups *groupsPtr = studentAuditPtr->degreePtr->reqGroups;
+		for (unsigned int j = 0; j < studentAuditPtr->numMissing; j++) {
+			RequirementGroup group = groupsPtr->groups[studentAuditPtr->missingGroups[j]];
+			if (j > 0) {
+				fprintf(reportFile, "; ");
+			}
+			for (unsigned int k = 0; k < group.count; k++) {
+				fprintf(reportFile, "%s%s", (k > 0) ? " OR " : "", groupsPtr->courses[group.offset + k]->name);
+			}
+		}
+		fprintf(reportFile, "\n");
+	}
+	return;
+}
+
+/*
+ * isCloserToGraduation() takes two GraduationCandidate
+ * pointers as arguments and returns true if the first
+ * has fewer requirement groups left, or as many and
+ * comes first in the Student array
+ */
+static inline bool isCloserToGraduation(GraduationCandidate *firstPtr, GraduationCandidate *secondPtr) {
+
+	return firstPtr->numMissing < secondPtr->numMissing
+			|| (firstPtr->numMissing == secondPtr->numMissing && firstPtr->order < secondPtr->order);
+}
+
+/*
+ * offerCandidate() takes a RankingHeap pointer, the most
+ * candidates it may hold, and a GraduationCandidate as
+ * arguments
+ *
+ * offerCandidate() adds the candidate while the heap has
+ * room and otherwise replaces the top - the farthest
+ * from graduating - if the candidate is closer, sifting
+ * it down to keep every parent farther than its children
+ */
+void offerCandidate(RankingHeap *heapPtr, unsigned int k, GraduationCandidate candidate) {
+
+	GraduationCandidate *heap = heapPtr->candidates;
+	unsigned int i;
+	if (k == 0) {
+		return;
+	}
+	if (heapPtr->numCandidates < k) {
+		// sifting up from the new last place
+		i = heapPtr->numCandidates;
+		heapPtr->numCandidates++;
+		while (i > 0 && isCloserToGraduation(heap + (i - 1) / 2, &candidate)) {
+			heap[i] = heap[(i - 1) / 2];
+			i = (i - 1) / 2;
+		}
+		heap[i] = candidate;
+		return;
+	}
+	if ( !isCloserToGraduation(&candidate, heap) ) {
+		return;
+	}
+
+	// sifting down from the top
+	i = 0;
+	while (true) {
+		unsigned int child = 2 * i + 1;
+		if (child >= k) {
+			break;
+		}
+		if (child + 1 < k && isCloserToGraduation(heap + child, heap + child + 1)) {
+			child++;
+		}
+		if ( !isCloserToGraduation(&candidate, heap + child) ) {
+			break;
+		}
+		heap[i] = heap[child];
+		i = child;
+	}
+	heap[i] = candidate;
+	return;
+}
+
+/*
+ * rankRangeOfStudents() takes an AuditRange pointer as
+ * its argument, in the form pthread_create() expects,
+ * and counts the unfulfilled requirement groups of each
+ * Student of the range in the Degree filter (or with
+ * any known Degree), offering each one to the range's
+ * own RankingHeap - returns NULL
+ */
+void* rankRangeOfStudents(void *rangeArg) {
+
+	AuditRange *rangePtr = (AuditRange*) rangeArg;
+	RankingShared *sharedPtr = (RankingShared*) rangePtr->shared;
+	RankingHeap *heapPtr = (RankingHeap*) rangePtr->result;
+	for (unsigned int i = rangePtr->first; i < rangePtr->last; i++) {
+		Student *studentPtr = sharedPtr->students[i];
+		// resolved before any thread started
+		Degree *degreePtr = studentPtr->degreePtr;
+		if ( degreePtr == NULL || (sharedPtr->degreeFilter != NULL && degreePtr != sharedPtr->degreeFilter) ) {
+			continue;
+		}
+		heapPtr->numAudited++;
+		GraduationCandidate candidate;
+		candidate.studentPtr = studentPtr;
+		candidate.numMissing = countUnfulfilledGroups(degreePtr->reqGroups, getStudentCompletedSet(studentPtr));
+		candidate.order = i;
+		offerCandidate(heapPtr, sharedPtr->k, candidate);
+	}
+	return NULL;
+}
+
+/*
+ * compareCandidates() compares two GraduationCandidates
+ * by how close they are to graduating, for qsort()
+ */
+int compareCandidates(const void *first, const void *second) {
+
+	GraduationCandidate *firstPtr = (GraduationCandidate*) first;
+	GraduationCandidate *secondPtr = (GraduationCandidate*) second;
+	if ( isCloserToGraduation(firstPtr, secondPtr) ) {
+		return -1;
+	}
+	return isCloserToGraduation(secondPtr, firstPtr);
+}
+
+/*
+ * rankClosestToGraduation() takes an array of Student
+ * pointers, the number of Students, a DegreeVector
+ * pointer, a Degree pointer to filter by (or NULL), and
+ * k as arguments
+ *
+ * rankClosestToGraduation() resolves every Student's
+ * Degree and flattens every Degree's requirements
+ * first, then has each thread keep the k Students of its
+ * range closest to graduating in a heap of its own (see
+ * runAuditRanges()) - no audit is kept for any other
+ * Student - and finally sorts the threads' heaps
+ * together and keeps the first k
+ *
+ * returns NULL for error
+ */
+GraduationRanking* rankClosestToGraduation(Student **students, unsigned int numStudents, DegreeVector *degListPtr, Degree *degreeFilter, unsigned int k) {
+
+	// checking for NULL pointer arguments
+	if ( (students == NULL && numStudents > 0) || degListPtr == NULL ) {
+		printf("\nCannot rank Students with "
+				"NULL Student array or "
+				"DegreeVector pointer "
+				"argument\n");
+		return NULL;
+	}
+	if (k == 0) {
+		printf("\nCannot rank Students without "
+				"keeping at least one\n");
+		return NULL;
+	}
+	// no more room than there are Students
+	if (k > numStudents) {
+		k = numStudents;
+	}
+
+	// making everything the threads share current
+	for (unsigned int i = 0; i < numStudents; i++) {
+		Degree *degreePtr = getStudentDegree(students[i], degListPtr);
+		if (degreePtr != NULL) {
+			getDegreeRequirementGroups(degreePtr);
+		}
+	}
+
+	RankingShared shared;
+	shared.students = students;
+	shared.degreeFilter = degreeFilter;
+	shared.k = k;
+	unsigned int numThreads = countAuditThreads(numStudents);
+	AuditRange *ranges = (AuditRange*) malloc(numThreads * sizeof(AuditRange));
+	RankingHeap *heaps = (RankingHeap*) malloc(numThreads * sizeof(RankingHeap));
+	// every heap's candidates in one array, so they can
+	// be sorted together afterwards
+	GraduationCandidate *candidates = (GraduationCandidate*) malloc( ( (size_t) numThreads * k + 1 ) * sizeof(GraduationCandidate) );
+	for (unsigned int t = 0; t < numThreads; t++) {
+		heaps[t].numAudited = 0;
+		heaps[t].numCandidates = 0;
+		heaps[t].candidates = candidates + (size_t) t * k;
+		ranges[t].shared = &shared;
+		ranges[t].result = heaps + t;
+	}
+	runAuditRanges(ranges, numThreads, numStudents, rankRangeOfStudents);
+
+	// allocating heap space
+	GraduationRanking *rankingPtr = (GraduationRanking*) malloc(sizeof(GraduationRanking));
+	// filling in data members
+	rankingPtr->numAudited = 0;
+	rankingPtr->numThreads = numThreads;
+	rankingPtr->numClosest = 0;
+	for (unsigned int t = 0; t < numThreads; t++) {
+		rankingPtr->numAudited += heaps[t].numAudited;
+		// moving the heap next to the ones before it
+		memmove(candidates + rankingPtr->numClosest, heaps[t].candidates, heaps[t].numCandidates * sizeof(GraduationCandidate));
+		rankingPtr->numClosest += heaps[t].numCandidates;
+	}
+	qsort(candidates, rankingPtr->numClosest, sizeof(GraduationCandidate), compareCandidates);
+	if (rankingPtr->numClosest > k) {
+		rankingPtr->numClosest = k;
+	}
+	rankingPtr->closest = candidates;
+
+	free(ranges);
+	free(heaps);
+	return rankingPtr;
+}
+
+/*
+ * freeGraduationRanking() takes a GraduationRanking
+ * pointer as an argument and frees its candidates and
+ * the GraduationRanking
+ */
+void freeGraduationRanking(GraduationRanking *rankingPtr) {
+
+	if (rankingPtr == NULL) {
+		return;
+	}
+	free(rankingPtr->closest);
+	free(rankingPtr);
+	return;
+}
+
+/*
+ * compareDegreeOptions() compares two DegreeOptions by
+ * how many requirement groups are left, then by their
+ * place in the DegreeVector, for qsort()
+ */
+int compareDegreeOptions(const void *first, const void *second) {
+
+	DegreeOption *firstPtr = (DegreeOption*) first;
+	DegreeOption *secondPtr = (DegreeOption*) second;
+	if (firstPtr->numMissing != secondPtr->numMissing) {
+		return (firstPtr->numMissing < secondPtr->numMissing) ? -1 : 1;
+	}
+	return (firstPtr->order < secondPtr->order) ? -1 : (firstPtr->order > secondPtr->order);
+}
+
+/*
+ * auditAcrossDegrees() takes a Student pointer and a
+ * DegreeVector pointer as arguments
+ *
+ * auditAcrossDegrees() gets the Student's completed set
+ * once and, for each Degree of the DegreeVector, counts
+ * the requirement groups and the Courses it leaves
+ * unfulfilled with the Degree's compiled masks (see
+ * countUnfulfilledGroups()), then sorts the Degrees,
+ * fewest groups left first
+ *
+ * returns NULL for error
+ */
+CrossDegreeAudit* auditAcrossDegrees(Student *studentPtr, DegreeVector *degListPtr) {
+
+	// checking for NULL pointer arguments
+	if (studentPtr == NULL || degListPtr == NULL) {
+		printf("\nCannot audit Student across "
+				"Degrees with NULL Student or "
+				"DegreeVector pointer "
+				"argument\n");
+		return NULL;
+	}
+
+	BitSet *completedPtr = getStudentCompletedSet(studentPtr);
+
+	// allocating heap space
+	CrossDegreeAudit *crossAuditPtr = (CrossDegreeAudit*) malloc(sizeof(CrossDegreeAudit));
+	// filling in data members
+	crossAuditPtr->studentPtr = studentPtr;
+	crossAuditPtr->numOptions = degListPtr->numDegs;
+	crossAuditPtr->options = (DegreeOption*) malloc( (degListPtr->numDegs + 1) * sizeof(DegreeOption) );
+	for (unsigned int i = 0; i < degListPtr->numDegs; i++) {
+		Degree *degreePtr = getDegreeAt(degListPtr, i);
+		RequirementGroups *groupsPtr = getDegreeRequirementGroups(degreePtr);
+		DegreeOption *optionPtr = &(crossAuditPtr->options[i]);
+		optionPtr->degreePtr = degreePtr;
+		optionPtr->numMissing = countUnfulfilledGroups(groupsPtr, completedPtr);
+		optionPtr->numGroups = groupsPtr->numGroups;
+		optionPtr->numMissingCourses = countMissingRequirements(groupsPtr, completedPtr);
+		optionPtr->order = i;
+	}
+	qsort(crossAuditPtr->options, crossAuditPtr->numOptions, sizeof(DegreeOption), compareDegreeOptions);
+	return crossAuditPtr;
+}
+
+/*
+ * freeCrossDegreeAudit() takes a CrossDegreeAudit
+ * pointer as an argument and frees its DegreeOptions
+ * and the CrossDegreeAudit
+ */
+void freeCrossDegreeAudit(CrossDegreeAudit *crossAuditPtr) {
+
+	if (crossAuditPtr == NULL) {
+		return;
+	}
+	free(crossAuditPtr->options);
+	free(crossAuditPtr);
+	return;
+}
@@ -0,0 +1,203 @@
+/*
+ *
+ *	Header file for the DegreeAudit ADT interface
+ *
+ *	A DegreeAudit checks many Students against their
+ *	Degree programs at once - the same question the 'm'
+ *	command answers for one Student - and records, for
+ *	each Student, the requirement groups (see
+ *	requirementGroups.h) the completed Courses do not
+ *	fulfill.
+ *
+ *	The Students are split into contiguous ranges, one
+ *	per thread, up to the number of online processors.
+ *	Everything the threads share is made current before
+ *	they start: every Student's Degree is resolved and
+ *	every Degree's RequirementGroups are flattened, so
+ *	the threads only read them. Each thread then only
+ *	touches its own Students (their completed sets) and
+ *	its own results.
+ *
+ *	The same threads can instead rank the Students by
+ *	how many requirement groups they have left: each
+ *	thread keeps only the k Students of its range that
+ *	are closest to graduating in a bounded heap, so
+ *	nothing is kept for any other Student, and the
+ *	threads' heaps are merged at the end.
+ *
+ *	One Student can also be audited against every
+ *	Degree of the DegreeVector at once, to see how far
+ *	each program would be: the Student's completed set
+ *	is looked up once and counted against each Degree's
+ *	requirement groups in turn. This is done on the
+ *	calling thread, since each Degree takes only a few
+ *	mask words.
+ *
+ *	The results are written as a tab-separated report,
+ *	one line per Student in the order given, with a
+ *	header line:
+ *		student, degree, status (complete, incomplete,
+ *		or unknown degree), number of missing groups,
+ *		and the missing groups - the Courses of a
+ *		group joined by " OR ", the groups joined
+ *		by "; "
+ *
+ */
+
+#ifndef DEGREEAUDIT_H
+#define DEGREEAUDIT_H
+
+#include <stdio.h>
+#include "student.h"
+#include "degreeVector.h"
+
+// fewest Students given to one thread
+#define AUDIT_STUDENTS_PER_THREAD 64
+
+// struct for the audit of one Student
+//
+// degreePtr is NULL if the Student's Degree is not in
+// the DegreeVector - missingGroups holds the indices of
+// the Degree's unfulfilled requirement groups
+typedef struct studentAudit {
+	Student *studentPtr;
+	Degree *degreePtr;
+	unsigned int numMissing;
+	unsigned int *missingGroups;
+} StudentAudit;
+
+// struct for the audit of many Students
+typedef struct degreeAudit {
+	unsigned int numStudents;
+	StudentAudit *audits;
+	unsigned int numThreads;
+} DegreeAudit;
+
+// struct for a Student ranked by how many requirement
+// groups are left - order is the Student's place in
+// the array ranked, which breaks ties
+typedef struct graduationCandidate {
+	Student *studentPtr;
+	unsigned int numMissing;
+	unsigned int order;
+} GraduationCandidate;
+
+// struct for the Students closest to graduating, the
+// closest first
+typedef struct graduationRanking {
+	unsigned int numAudited;
+	unsigned int numThreads;
+	unsigned int numClosest;
+	GraduationCandidate *closest;
+} GraduationRanking;
+
+// struct for how far one Student is from one Degree
+// program - order is the Degree's place in the
+// DegreeVector, which breaks ties
+typedef struct degreeOption {
+	Degree *degreePtr;
+	unsigned int numMissing;
+	unsigned int numGroups;
+	int numMissingCourses;
+	unsigned int order;
+} DegreeOption;
+
+// struct for one Student audited against every Degree
+// program, the closest first
+typedef struct crossDegreeAudit {
+	Student *studentPtr;
+	unsigned int numOptions;
+	DegreeOption *options;
+} CrossDegreeAudit;
+
+
+// DegreeAudit interface
+
+/*
+ * audits every Student of the array against
+ * their Degree program, in parallel,
+ * and returns a pointer to the new
+ * DegreeAudit
+ *
+ * students - array of Student pointers
+ *
+ * numStudents - number of Students in the
+ * array
+ *
+ * degListPtr - pointer to the DegreeVector
+ * the Students' Degrees are found in
+ */
+DegreeAudit* runDegreeAudit(Student** students, unsigned int numStudents, DegreeVector* degListPtr);
+
+/*
+ * frees a DegreeAudit and its results
+ *
+ * auditPtr - pointer to the DegreeAudit to
+ * free
+ */
+void freeDegreeAudit(DegreeAudit* auditPtr);
+
+/*
+ * writes the DegreeAudit's report to an
+ * open file
+ *
+ * auditPtr - pointer to the DegreeAudit
+ *
+ * reportFile - file opened for writing
+ */
+void writeDegreeAudit(DegreeAudit* auditPtr, FILE* reportFile);
+
+/*
+ * finds, in parallel, the k Students of the
+ * array with the fewest unfulfilled
+ * requirement groups in their Degree
+ * programs and returns a pointer to the new
+ * GraduationRanking of them
+ *
+ * students - array of Student pointers
+ *
+ * numStudents - number of Students in the
+ * array
+ *
+ * degListPtr - pointer to the DegreeVector
+ * the Students' Degrees are found in
+ *
+ * degreeFilter - pointer to the only Degree
+ * whose Students are ranked, or NULL to
+ * rank every Student with a known Degree
+ *
+ * k - most Students to keep
+ */
+GraduationRanking* rankClosestToGraduation(Student** students, unsigned int numStudents, DegreeVector* degListPtr, Degree* degreeFilter, unsigned int k);
+
+/*
+ * frees a GraduationRanking
+ *
+ * rankingPtr - pointer to the
+ * GraduationRanking to free
+ */
+void freeGraduationRanking(GraduationRanking* rankingPtr);
+
+/*
+ * audits one Student against every Degree
+ * of the DegreeVector and returns a pointer
+ * to the new CrossDegreeAudit, the Degrees
+ * with the fewest unfulfilled requirement
+ * groups first
+ *
+ * studentPtr - pointer to the Student
+ *
+ * degListPtr - pointer to the DegreeVector
+ * of every Degree program
+ */
+CrossDegreeAudit* auditAcrossDegrees(Student* studentPtr, DegreeVector* degListPtr);
+
+/*
+ * frees a CrossDegreeAudit
+ *
+ * crossAuditPtr - pointer to the
+ * CrossDegreeAudit to free
+ */
+void freeCrossDegreeAudit(CrossDegreeAudit* crossAuditPtr);
+
+#endif
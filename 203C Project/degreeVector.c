@@ -7,8 +7,8 @@
  *	DegreeVector is a ADT for storing structures of 
  *	type Degree in an easy an efficient manner
  *
- *	DegreeVector is a variable space of dynamic
- *	memory containing Degree pointers
+ *	DegreeVector is a variable number of chunks
+ *	of dynamic memory containing Degrees
  *
  *	More in the associated header file
  *
@@ -28,12 +28,17 @@
  * in the DegreeVector at any given time
  *
  * capacity is the current total of Degrees 
- * for which heap space has been allocated
- * 	variable as needed
+ * for which heap space has been allocated,
+ * one chunk of DEGREE_CHUNK_SIZE to start
  *
- * degrees is a pointer to the start of the 
- * area of memory containing all of the Degree 
- * pointers
+ * chunks is a pointer to the chunk pointers,
+ * with room for chunkCapacity of them
+ *
+ * version starts at one so that a Student that
+ * has never resolved its Degree (version zero)
+ * is always out of date
+ *
+ * nameIndex starts empty (see nameIndex.h)
  */
 DegreeVector* initDegreeVector() {
 
@@ -41,11 +46,125 @@ DegreeVector* initDegreeVector() {
 	DegreeVector *degVectorPtr = (DegreeVector*) malloc(sizeof(DegreeVector));
 	// filling in data members
 	degVectorPtr->numDegs = 0;
-	degVectorPtr->capacity = 10;
-	degVectorPtr->degrees = (Degree*) calloc( (degVectorPtr->capacity), sizeof(Degree) );
+	degVectorPtr->version = 1;
+	degVectorPtr->chunkCapacity = 4;
+	degVectorPtr->chunks = (Degree**) malloc( degVectorPtr->chunkCapacity * sizeof(Degree*) );
+	degVectorPtr->chunks[0] = (Degree*) calloc(DEGREE_CHUNK_SIZE, sizeof(Degree));
+	degVectorPtr->numChunks = 1;
+	degVectorPtr->capacity = DEGREE_CHUNK_SIZE;
+	degVectorPtr->nameIndex = initNameIndex();
 	return degVectorPtr;
 }
 
+/*
+ * freeDegreeVector() takes a DegreeVector pointer as an
+ * argument and frees each Degree's requirement Vector and
+ * RequirementGroups, its chunks, its chunk pointers, its
+ * name index, and the DegreeVector
+ *
+ * the Degrees' names are pooled and are not freed here
+ */
+void freeDegreeVector(DegreeVector *degListPtr) {
+
+	if (degListPtr == NULL) {
+		return;
+	}
+	for (unsigned int i = 0; i < degListPtr->numDegs; i++) {
+		Degree *degreePtr = getDegreeAt(degListPtr, i);
+		freeVector(degreePtr->reqCourses);
+		freeRequirementGroups(degreePtr->reqGroups);
+	}
+	for (unsigned int c = 0; c < degListPtr->numChunks; c++) {
+		free(degListPtr->chunks[c]);
+	}
+	free(degListPtr->chunks);
+	freeNameIndex(degListPtr->nameIndex);
+	free(degListPtr);
+	return;
+}
+
+
+/*
+ * addDegreeChunk() takes a DegreeVector pointer as an
+ * argument and allocates one more chunk of Degrees,
+ * doubling the room for chunk pointers first if it is
+ * full - only the chunk pointers are reallocated, so no
+ * Degree moves
+ */
+void addDegreeChunk(DegreeVector *degListPtr) {
+
+	if (degListPtr->numChunks == degListPtr->chunkCapacity) {
+		degListPtr->chunkCapacity *= 2;
+		degListPtr->chunks = (Degree**) realloc(degListPtr->chunks, degListPtr->chunkCapacity * sizeof(Degree*));
+	}
+	degListPtr->chunks[degListPtr->numChunks] = (Degree*) calloc(DEGREE_CHUNK_SIZE, sizeof(Degree));
+	degListPtr->numChunks++;
+	degListPtr->capacity += DEGREE_CHUNK_SIZE;
+	return;
+}
+
+/*
+ * reserveDegreeVector() takes a DegreeVector pointer and
+ * a number of Degrees as arguments and allocates chunks
+ * until the DegreeVector's capacity is at least
+ * minCapacity, making room for all of their chunk
+ * pointers in one step
+ */
+void reserveDegreeVector(DegreeVector *degListPtr, unsigned int minCapacity) {
+
+	// checking for NULL pointer argument
+	if (degListPtr == NULL) {
+		printf("\nCannot reserve space in the "
+				"DegreeVector with a NULL "
+				"DegreeVector pointer "
+				"argument\n");
+		return;
+	}
+
+	unsigned int numChunks = (minCapacity + DEGREE_CHUNK_SIZE - 1) / DEGREE_CHUNK_SIZE;
+	if (numChunks > degListPtr->chunkCapacity) {
+		degListPtr->chunkCapacity = numChunks;
+		degListPtr->chunks = (Degree**) realloc(degListPtr->chunks, degListPtr->chunkCapacity * sizeof(Degree*));
+	}
+	while (degListPtr->numChunks < numChunks) {
+		addDegreeChunk(degListPtr);
+	}
+	return;
+}
+
+/*
+ * shrinkDegreeVectorToFit() takes a DegreeVector pointer
+ * as an argument, frees every chunk after the one the
+ * last Degree is in (keeping at least one chunk), and
+ * reduces the room for chunk pointers to the chunks left
+ *
+ * the Degrees stay where they are
+ */
+void shrinkDegreeVectorToFit(DegreeVector *degListPtr) {
+
+	// checking for NULL pointer argument
+	if (degListPtr == NULL) {
+		printf("\nCannot shrink the DegreeVector "
+				"with a NULL DegreeVector "
+				"pointer argument\n");
+		return;
+	}
+
+	unsigned int numChunks = (degListPtr->numDegs + DEGREE_CHUNK_SIZE - 1) / DEGREE_CHUNK_SIZE;
+	if (numChunks == 0) {
+		numChunks = 1;
+	}
+	while (degListPtr->numChunks > numChunks) {
+		degListPtr->numChunks--;
+		free(degListPtr->chunks[degListPtr->numChunks]);
+	}
+	degListPtr->capacity = numChunks * DEGREE_CHUNK_SIZE;
+	if (numChunks != degListPtr->chunkCapacity) {
+		degListPtr->chunkCapacity = numChunks;
+		degListPtr->chunks = (Degree**) realloc(degListPtr->chunks, degListPtr->chunkCapacity * sizeof(Degree*));
+	}
+	return;
+}
 
 /*
  * addDegree() takes a pointer to a DegreeVector 
@@ -55,13 +174,20 @@ DegreeVector* initDegreeVector() {
  * pointed to by degListPtr with the Degree pointed 
  * to by degreePtr
  *
- * increases list capacity as necessary by double
- * - reallocating heap space for the Vector when the
- * numDegs reaches the capacity
+ * allocates a new chunk when the numDegs reaches
+ * the capacity - the Degrees already added stay
+ * where they are
  *
  * updates the DegreeVector's numDegs
  * adds the new Degree to the Vector's 
- * degrees
+ * last chunk
+ *
+ * bumps the DegreeVector's version so that
+ * Students whose Degree was not found look
+ * for it again
+ *
+ * indexes the new Degree's name at its position,
+ * unless an earlier Degree has the same name
  */
 void addDegree(DegreeVector *degListPtr, Degree *degreePtr) {
 
@@ -80,29 +206,42 @@ void addDegree(DegreeVector *degListPtr, Degree *degreePtr) {
 				"argument\n");
 		return;
 	}
-	// check to see if we need to double capacity
+	// check to see if we need another chunk
 	if (degListPtr->numDegs == degListPtr->capacity) {
-		int originalCapacity = degListPtr->capacity;
-		int newCapacity = originalCapacity * 2;
-		degListPtr->degrees = (Degree*) realloc(degListPtr->degrees, newCapacity * sizeof(Degree));
-		degListPtr->capacity = newCapacity;
+		addDegreeChunk(degListPtr);
 	}
 
 	// adding department course to the list (vector) and updating department's size
-	int originalSize = degListPtr->numDegs;
-	degListPtr->degrees[originalSize] = *degreePtr;
+	unsigned int originalSize = degListPtr->numDegs;
+	degListPtr->chunks[originalSize / DEGREE_CHUNK_SIZE][originalSize % DEGREE_CHUNK_SIZE] = *degreePtr;
 	degListPtr->numDegs = originalSize + 1;
+	addToNameIndex(degListPtr->nameIndex, degreePtr->name, originalSize);
+	degListPtr->version++;
 	return;
 }	
 
+/*
+ * getDegreeAt() takes a DegreeVector pointer and a
+ * position as arguments and returns a pointer to the
+ * Degree at that position in its chunk, or NULL if the
+ * position is past the last Degree
+ */
+Degree* getDegreeAt(DegreeVector *degListPtr, unsigned int index) {
+
+	if (degListPtr == NULL || index >= degListPtr->numDegs) {
+		return NULL;
+	}
+	return degListPtr->chunks[index / DEGREE_CHUNK_SIZE] + index % DEGREE_CHUNK_SIZE;
+}
+
 /*
  * findInDegreeVector() takes a DegreeVector pointer, degListPtr,
  * and a Degree name string to find in the DegreeVector, degreeName
  *
- * findInDegreeVector() loops through all of the Degree pointers in
- * the given DegreeVector with a temporary Degree pointer and checks
- * each Degree in the Vector against the given degreeName with the
- * function from string.h, strcmp()
+ * findInDegreeVector() looks the degreeName up in the DegreeVector's
+ * name index, which holds the position of the first Degree with each
+ * name - only a Degree whose name has the same hash is compared
+ * with strcmp()
  *
  * findInDegreeVector() returns a Degree pointer if the Degree is
  * found, and returns NULL if no Degree with degreeName is found
@@ -129,14 +268,11 @@ Degree* findInDegreeVector(DegreeVector *degListPtr, char *degreeName) {
 		return NULL;
 	}
 
-	// looping through all Degrees in the DegreeVector
-	// looking for a Degree of degreeName	
-	Degree *degPtr = degListPtr->degrees;
-	for (int i = 0; i < degListPtr->numDegs; i++) {
-		if ( strcmp(degreeName, degPtr->name) == 0 ) {
-			return degPtr;
-		}
-		degPtr++;
+	// looking up the position of the Degree of
+	// degreeName in the name index
+	unsigned int position = findInNameIndex(degListPtr->nameIndex, degreeName);
+	if (position == NAME_NOT_INDEXED) {
+		return NULL;
 	}
-	return NULL;
+	return getDegreeAt(degListPtr, position);
 }
@@ -10,18 +10,47 @@
  *	everytime a new input file of type Degree 
  *	is input into the program.
  *
+ *	Degrees are stored in chunks of DEGREE_CHUNK_SIZE
+ *	Degrees. A new chunk is allocated when the last one
+ *	is full, and only the array of chunk pointers is ever
+ *	reallocated, so a Degree never moves once it is
+ *	added - a Degree pointer from findInDegreeVector()
+ *	or getDegreeAt() stays valid for as long as the
+ *	DegreeVector does.
+ *
  */
 
 #ifndef DEGREEVECTOR_H
 #define DEGREEVECTOR_H
 
 #include "degree.h"
+#include "nameIndex.h"
+
+// number of Degrees in each chunk of a DegreeVector
+#define DEGREE_CHUNK_SIZE 16
 
 // struct for managing the list of degree programs
+//
+// Degree i is at chunks[i / DEGREE_CHUNK_SIZE] +
+// i % DEGREE_CHUNK_SIZE - capacity is the number of
+// Degrees the numChunks chunks hold, and chunkCapacity
+// the number of chunk pointers there is room for
+//
+// version is bumped every time a Degree is added to 
+// the DegreeVector - a name that was not found before
+// the bump may be found now (see getStudentDegree()
+// in student.h)
+//
+// nameIndex finds a Degree's position by name, and is
+// kept up to date by addDegree()
 typedef struct degreeVector {
 	unsigned int numDegs;
 	unsigned int capacity;
-	Degree *degrees;	
+	unsigned int version;
+	unsigned int numChunks;
+	unsigned int chunkCapacity;
+	Degree **chunks;
+	NameIndex *nameIndex;
 } DegreeVector;
 
 // interface
@@ -29,27 +58,39 @@ typedef struct degreeVector {
 
 /*
  * allocates heap space for a DegreeVector
- * and, initially, ten Degree pointers
+ * and its first chunk of DEGREE_CHUNK_SIZE
+ * Degrees
  *
  * initializes a DegreeVector's data members
  * including the numDegs, the number of 
  * Degress, as zero, and the initial
- * capacity, at ten
+ * capacity, at one chunk
  *
- * the DegreeVectors degrees data member
- * is a pointer to the first Degree pointer
- * of the DegreeVector in memory
+ * the DegreeVector's name index starts
+ * empty
  */
 DegreeVector* initDegreeVector();
 
+/*
+ * frees a DegreeVector, its chunks, its
+ * name index, and each Degree's Vector and
+ * RequirementGroups - the Degrees' pooled
+ * names are not freed
+ *
+ * degListPtr - pointer to the DegreeVector
+ * to free
+ */
+void freeDegreeVector(DegreeVector* degListPtr);
+
 
 /*
  * adds a Degree to the DegreeVector
- * increases the DegreeVector's numDegs
- * and increases the capacity of the
- * DegreeVector as needed (once the 
- * numDegs reaches the same value as
- * the capacity)
+ * increases the DegreeVector's numDegs,
+ * bumps the DegreeVector's version,
+ * indexes the Degree's name,
+ * and allocates a new chunk once the
+ * numDegs reaches the capacity - no
+ * Degree already added is moved
  *
  * degListPtr - pointer to the 
  * DegreeVector we are adding a
@@ -60,10 +101,46 @@ DegreeVector* initDegreeVector();
  */
 void addDegree(DegreeVector* degListPtr, Degree* degreePtr);
 
+/*
+ * allocates chunks, in one step, so that
+ * the DegreeVector can hold at least
+ * minCapacity Degrees
+ *
+ * degListPtr - pointer to the DegreeVector
+ * to grow
+ *
+ * minCapacity - number of Degrees the 
+ * DegreeVector must have room for
+ */
+void reserveDegreeVector(DegreeVector* degListPtr, unsigned int minCapacity);
+
+/*
+ * frees the DegreeVector's empty chunks,
+ * keeping at least one, and its unused
+ * chunk pointers - no Degree is moved
+ *
+ * degListPtr - pointer to the DegreeVector
+ * to shrink
+ */
+void shrinkDegreeVectorToFit(DegreeVector* degListPtr);
+
+/*
+ * returns a pointer to the Degree at the
+ * given position of the DegreeVector, in the
+ * order the Degrees were added, or NULL if
+ * there is no Degree there
+ *
+ * degListPtr - pointer to the DegreeVector
+ *
+ * index - position of the Degree
+ */
+Degree* getDegreeAt(DegreeVector* degListPtr, unsigned int index);
+
 
 /*
  * finds a Degree with given degree name argument
- * in the DegreeVector specified
+ * in the DegreeVector specified, through the
+ * DegreeVector's name index
  *
  * returns a pointer to the Degree, if found
  * and otherwise returns NULL
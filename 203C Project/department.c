@@ -16,13 +16,14 @@
 #include "department.h"
 #include "coursePtrVector.h"
 #include "courseBT.h"
+#include "stringPool.h"
 
 /*
  * initDepartment() takes a Department name as a string argument
  * initDepartment() initializes type Department by allocating 
  * heap space, initializing its data members including the 
  * Department name with depName and the (intially empty)
- * Vector of Elements of Course pointer references 
+ * sorted Vector of Elements of Course pointer references 
  * initDepartment() returns a pointer to the new Department
  */
 Department* initDepartment(char* depName) {
@@ -38,8 +39,8 @@ Department* initDepartment(char* depName) {
 	// allocating heap space
 	Department *depPtr = (Department*) malloc(sizeof(Department));
 	// filling in data members
-	depPtr->name = depName;
-	depPtr->depCourses = initVector(); 
+	depPtr->name = internString(depName);
+	depPtr->depCourses = initSortedVector();
 	return depPtr;
 }
 
@@ -70,14 +71,41 @@ void addDepartmentCourse(Department *departmentPtr, Course *coursePtr) {
 				"argument\n");
 		return;
 	}
-	// initializing Element with the Course pointer 
-	// and adding Element to the Department's Vector
-	Element* newDepCourse = initElement(coursePtr);
-	addElement(departmentPtr->depCourses, newDepCourse);
+	// building the Element with the Course pointer 
+	// directly in the Department's Vector
+	emplaceElement(departmentPtr->depCourses, coursePtr);
 	return;
 }	
 
 
+/*
+ * addDepartmentCourses() takes a pointer to a Department,
+ * an array of Course pointers, and the number of Courses
+ * in the array as arguments
+ *
+ * addDepartmentCourses() adds all of the Courses to the
+ * Department's Course pointer Vector with a single call
+ * to emplaceElements()
+ */
+void addDepartmentCourses(Department *departmentPtr, Course **courses, int numCourses) {
+
+	// checking for null pointers
+	if (departmentPtr == NULL) {
+		printf("\nCannot add Courses to Department "
+				"with NULL Department "
+				"pointer argument\n");
+		return;
+	}
+	if (courses == NULL || numCourses < 0) {
+		printf("\nCannot add Courses to Department "
+				"without a Course pointer "
+				"array argument\n");
+		return;
+	}
+	emplaceElements(departmentPtr->depCourses, courses, numCourses);
+	return;
+}
+
 /*
  * loadDepartment() takes lines, an array of strings, 
  * and numLinesInFile from a formatted input file as arguments
@@ -92,7 +120,8 @@ void addDepartmentCourse(Department *departmentPtr, Course *coursePtr) {
  * loadDepartment() puts all given Course information into each 
  * Course struct read from the array of strings, lines
  * this includes the prerequisites for each Course, the Department 
- * it belongs to and the title of each Course
+ * it belongs to and the title of each Course - the prerequisites
+ * are compiled with compileCoursePrerequisites()
  *
  * loadDepartment() adds Elements with Course pointers to all
  * of the Department's Courses on the CourseBinaryTree into
@@ -124,8 +153,14 @@ Department* loadDepartment(char **lines, int numLinesInFile, CourseBinaryTree *c
 				"pointer argument\n");
 		return NULL;
 	}
-	// creating a pointer to Department
+	// creating a pointer to Department - its name line is
+	// pooled, as every one of its Courses keeps it too
+	lines[1] = internHeapString(lines[1]);
 	Department *depPtr = initDepartment(lines[1]);
+	// every three lines name at most one Course, so the
+	// Courses are gathered first and added all at once
+	Course **depCourses = (Course**) malloc( (numLinesInFile / 3 + 1) * sizeof(Course*) );
+	int numDepCourses = 0;
 
 	// looping through department courses
 	for (int j = 2; j < numLinesInFile; j += 3) {
@@ -133,6 +168,7 @@ Department* loadDepartment(char **lines, int numLinesInFile, CourseBinaryTree *c
 		if ( strcmp(lines[j], "") != 0) {
 
 			// put/find first course on the tree
+			lines[j] = internHeapString(lines[j]);
 			Course *coursePtr = insertInCourseBinaryTree(courseTreePtr, lines[j]);
 			// make sure course title line is not empty
 			if ( strcmp(lines[j+1], "") != 0 ) {
@@ -141,25 +177,26 @@ Department* loadDepartment(char **lines, int numLinesInFile, CourseBinaryTree *c
 			}
 			// add department name to the course
 			coursePtr->depName = lines[1];
-			// add course pointer to department
-			addDepartmentCourse(depPtr, coursePtr);
+			// gather course pointer for department
+			depCourses[numDepCourses] = coursePtr;
+			numDepCourses++;
 			// checking to see if prerequisite line is empty	
 			if ( strcmp(lines[j+2], "") != 0 ) {
 				// put prereq strings into the course struct
-				// and put each prerequisite onto the course tree
 				char **courseStringsArr = NULL;
 				int numStrings = splitStringAtComma(lines[j+2], &courseStringsArr);
 				for (int i = 0; i < numStrings; i++) {
 					// does not ignore OR to keep track of disjuncts
 					appendPrereqToCourse(coursePtr, courseStringsArr[i]);
-					// we don't want OR on the course tree
-					if ( strcmp(courseStringsArr[i], "OR") != 0) {
-						insertInCourseBinaryTree(courseTreePtr, courseStringsArr[i]);
-					}
 				}
+				// compile the prereqs, which puts each 
+				// prerequisite onto the course tree
+				compileCoursePrerequisites(courseTreePtr, coursePtr);
 			}
 		}
 	}
+	addDepartmentCourses(depPtr, depCourses, numDepCourses);
+	free(depCourses);
 	return depPtr;
 }
 
@@ -24,6 +24,11 @@
 #include "courseBT.h"
 
 // struct for data related to each department
+//
+// depCourses is a sorted Vector whose first Courses are
+// stored inline in the Vector's own allocation - it is
+// not placed inside the Department because Departments
+// are copied by value into the DepartmentVector
 typedef struct department {
 	char *name;
 	Vector *depCourses;
@@ -64,6 +69,22 @@ Department* initDepartment(char* depName);
  */
 void addDepartmentCourse(Department* departmentPtr, Course* coursePtr);
 
+/*
+ * adds every Course in an array to the 
+ * Department's Course pointer Vector of
+ * Elements, growing the Vector only once
+ *
+ * departmentPtr - pointer to the 
+ * Department we are adding Courses to
+ *
+ * courses - array of pointers to the
+ * Courses we want to add
+ *
+ * numCourses - number of Courses in
+ * the array
+ */
+void addDepartmentCourses(Department* departmentPtr, Course** courses, int numCourses);
+
 /*
  * takes an array of lines from the given
  * Department file and loads every Course
@@ -20,8 +20,9 @@
  * initDepartmentVector() initializes type DepartmentVector by 
  * allocating space on the heap for a DepartmentVector,
  * setting its Department count to zero and allocating space on 
- * the heap for ten structures of type Department - the initial
- * Vector capacity is initialized to ten
+ * the heap for its first chunk of DEPARTMENT_CHUNK_SIZE
+ * Departments - the initial Vector capacity is one chunk - and
+ * the name index starts empty (see nameIndex.h)
  * initDepartmentVector() returns a pointer to the 
  * DeparmentVector
  */
@@ -31,18 +32,129 @@ DepartmentVector* initDepartmentVector() {
 	DepartmentVector *depVectorPtr = (DepartmentVector*) malloc(sizeof(DepartmentVector));
 	// initializing data members
 	depVectorPtr->numDeps = 0;
-	depVectorPtr->capacity = 10;
-	depVectorPtr->departments = (Department*) calloc( (depVectorPtr->capacity), sizeof(Department) );
+	depVectorPtr->chunkCapacity = 4;
+	depVectorPtr->chunks = (Department**) malloc( depVectorPtr->chunkCapacity * sizeof(Department*) );
+	depVectorPtr->chunks[0] = (Department*) calloc(DEPARTMENT_CHUNK_SIZE, sizeof(Department));
+	depVectorPtr->numChunks = 1;
+	depVectorPtr->capacity = DEPARTMENT_CHUNK_SIZE;
+	depVectorPtr->nameIndex = initNameIndex();
 	return depVectorPtr;
 }
 
+/*
+ * freeDepartmentVector() takes a DepartmentVector pointer
+ * as an argument and frees each Department's Course
+ * Vector, its chunks, its chunk pointers, its name index,
+ * and the DepartmentVector
+ *
+ * the Departments' names are pooled and are not freed here
+ */
+void freeDepartmentVector(DepartmentVector *depListPtr) {
+
+	if (depListPtr == NULL) {
+		return;
+	}
+	for (unsigned int i = 0; i < depListPtr->numDeps; i++) {
+		freeVector(getDepartmentAt(depListPtr, i)->depCourses);
+	}
+	for (unsigned int c = 0; c < depListPtr->numChunks; c++) {
+		free(depListPtr->chunks[c]);
+	}
+	free(depListPtr->chunks);
+	freeNameIndex(depListPtr->nameIndex);
+	free(depListPtr);
+	return;
+}
+
+/*
+ * addDepartmentChunk() takes a DepartmentVector pointer
+ * as an argument and allocates one more chunk of
+ * Departments, doubling the room for chunk pointers
+ * first if it is full - no Department moves
+ */
+void addDepartmentChunk(DepartmentVector *depListPtr) {
+
+	if (depListPtr->numChunks == depListPtr->chunkCapacity) {
+		depListPtr->chunkCapacity *= 2;
+		depListPtr->chunks = (Department**) realloc(depListPtr->chunks, depListPtr->chunkCapacity * sizeof(Department*));
+	}
+	depListPtr->chunks[depListPtr->numChunks] = (Department*) calloc(DEPARTMENT_CHUNK_SIZE, sizeof(Department));
+	depListPtr->numChunks++;
+	depListPtr->capacity += DEPARTMENT_CHUNK_SIZE;
+	return;
+}
+
+/*
+ * reserveDepartmentVector() takes a DepartmentVector
+ * pointer and a number of Departments as arguments and
+ * allocates chunks until the DepartmentVector's capacity
+ * is at least minCapacity, making room for all of their
+ * chunk pointers in one step
+ */
+void reserveDepartmentVector(DepartmentVector *depListPtr, unsigned int minCapacity) {
+
+	// checking for NULL pointer argument
+	if (depListPtr == NULL) {
+		printf("\nCannot reserve space in the "
+				"Department list with NULL "
+				"DepartmentVector pointer "
+				"argument\n");
+		return;
+	}
+
+	unsigned int numChunks = (minCapacity + DEPARTMENT_CHUNK_SIZE - 1) / DEPARTMENT_CHUNK_SIZE;
+	if (numChunks > depListPtr->chunkCapacity) {
+		depListPtr->chunkCapacity = numChunks;
+		depListPtr->chunks = (Department**) realloc(depListPtr->chunks, depListPtr->chunkCapacity * sizeof(Department*));
+	}
+	while (depListPtr->numChunks < numChunks) {
+		addDepartmentChunk(depListPtr);
+	}
+	return;
+}
+
+/*
+ * shrinkDepartmentVectorToFit() takes a DepartmentVector
+ * pointer as an argument, frees every chunk after the
+ * one the last Department is in (keeping at least one
+ * chunk), and reduces the room for chunk pointers to the
+ * chunks left - the Departments stay where they are
+ */
+void shrinkDepartmentVectorToFit(DepartmentVector *depListPtr) {
+
+	// checking for NULL pointer argument
+	if (depListPtr == NULL) {
+		printf("\nCannot shrink the Department list "
+				"with NULL DepartmentVector "
+				"pointer argument\n");
+		return;
+	}
+
+	unsigned int numChunks = (depListPtr->numDeps + DEPARTMENT_CHUNK_SIZE - 1) / DEPARTMENT_CHUNK_SIZE;
+	if (numChunks == 0) {
+		numChunks = 1;
+	}
+	while (depListPtr->numChunks > numChunks) {
+		depListPtr->numChunks--;
+		free(depListPtr->chunks[depListPtr->numChunks]);
+	}
+	depListPtr->capacity = numChunks * DEPARTMENT_CHUNK_SIZE;
+	if (numChunks != depListPtr->chunkCapacity) {
+		depListPtr->chunkCapacity = numChunks;
+		depListPtr->chunks = (Department**) realloc(depListPtr->chunks, depListPtr->chunkCapacity * sizeof(Department*));
+	}
+	return;
+}
+
 /*
  * addDepartment() takes a pointer to DepartmentVector, depListPtr, and 
  * a pointer to the Department to be added, departmentPtr, as its arguments
- * addDepartment() adds a Department to the DepartmentVector's Vector
- * (contiguous memory)
- * and increments the DepartmentVector's numDeps data member
- * addDepartment() increases list capacity as necessary
+ * addDepartment() adds a Department to the DepartmentVector's last
+ * chunk and increments the DepartmentVector's numDeps data member
+ * addDepartment() indexes the Department's name at its position,
+ * unless an earlier Department has the same name
+ * addDepartment() allocates a new chunk as necessary, without moving
+ * the Departments already added
  */
 void addDepartment(DepartmentVector *depListPtr, Department *departmentPtr) {
 
@@ -61,26 +173,40 @@ void addDepartment(DepartmentVector *depListPtr, Department *departmentPtr) {
 				"argument\n");
 		return;
 	}
-	// check to see if we need to double capacity
+	// check to see if we need another chunk
 	if (depListPtr->numDeps == depListPtr->capacity) {
-		int originalCapacity = depListPtr->capacity;
-		depListPtr->departments = (Department*) realloc(depListPtr->departments, (originalCapacity * 2) * sizeof(Department));
-		depListPtr->capacity = originalCapacity * 2;
+		addDepartmentChunk(depListPtr);
 	}	
 	
 	// adding Department to the list (Vector) and updating the Department list size
-	int originalSize = depListPtr->numDeps;
-	depListPtr->departments[originalSize] = *departmentPtr;
+	unsigned int originalSize = depListPtr->numDeps;
+	depListPtr->chunks[originalSize / DEPARTMENT_CHUNK_SIZE][originalSize % DEPARTMENT_CHUNK_SIZE] = *departmentPtr;
 	depListPtr->numDeps = originalSize + 1;
+	addToNameIndex(depListPtr->nameIndex, departmentPtr->name, originalSize);
 	return;
 }
 
+/*
+ * getDepartmentAt() takes a DepartmentVector pointer and
+ * a position as arguments and returns a pointer to the
+ * Department at that position in its chunk, or NULL if
+ * the position is past the last Department
+ */
+Department* getDepartmentAt(DepartmentVector *depListPtr, unsigned int index) {
+
+	if (depListPtr == NULL || index >= depListPtr->numDeps) {
+		return NULL;
+	}
+	return depListPtr->chunks[index / DEPARTMENT_CHUNK_SIZE] + index % DEPARTMENT_CHUNK_SIZE;
+}
+
 /*
  * findInDepartmentVector() takes a DepartmentVector pointer, depListPtr,
  * and Department name C string as arguments
  *
- * findInDepartmentVector() iterates through the given DepartmentVector
- * searching for a Department with name departmentName (strcmp())
+ * findInDepartmentVector() looks departmentName up in the given
+ * DepartmentVector's name index - only a Department whose name has
+ * the same hash is compared with strcmp()
  *
  * if the Department is found, findInDepartmentVector() returns a pointer
  * to the Department with name departmentName
@@ -106,15 +232,12 @@ Department* findInDepartmentVector(DepartmentVector *depListPtr, char *departmen
 		return NULL;
 	}
 
-	// iterating through all Departments and checking
-	// Department names	
-	Department *depPtr = depListPtr->departments;
-	for (int i = 0; i < depListPtr->numDeps; i++) {
-		if ( strcmp(departmentName, depPtr->name) == 0 ) {
-			return depPtr;
-		}
-		depPtr++;
+	// looking up the position of the Department of
+	// departmentName in the name index
+	unsigned int position = findInNameIndex(depListPtr->nameIndex, departmentName);
+	if (position == NAME_NOT_INDEXED) {
+		// Department not found
+		return NULL;
 	}
-	// Department not found
-	return NULL;
+	return getDepartmentAt(depListPtr, position);
 }
@@ -13,39 +13,73 @@
  *	The DepartmentVector is also updated with every new Department
  *	added using the 'a' command from user input in the program
  *	terminal
+ *
+ *	Departments are stored in chunks of DEPARTMENT_CHUNK_SIZE
+ *	Departments. Only the array of chunk pointers is ever
+ *	reallocated, so a Department pointer from
+ *	findInDepartmentVector() or getDepartmentAt() stays valid
+ *	after later Departments are added.
  */
 
 #ifndef DEPARTMENTVECTOR_H
 #define DEPARTMENTVECTOR_H
 
 #include "department.h"
+#include "nameIndex.h"
+
+// number of Departments in each chunk of a
+// DepartmentVector
+#define DEPARTMENT_CHUNK_SIZE 16
 
 // vector struct for elements of type Deparment
+//
+// Department i is at chunks[i / DEPARTMENT_CHUNK_SIZE] +
+// i % DEPARTMENT_CHUNK_SIZE - capacity is the number of
+// Departments the numChunks chunks hold, and
+// chunkCapacity the number of chunk pointers there is
+// room for
+//
+// nameIndex finds a Department's position by name,
+// and is kept up to date by addDepartment()
 typedef struct departmentVector {
 	unsigned int numDeps;
 	unsigned int capacity;
-	Department *departments;
+	unsigned int numChunks;
+	unsigned int chunkCapacity;
+	Department **chunks;
+	NameIndex *nameIndex;
 } DepartmentVector;
 
 
 // DepartmentVector interface
 
 /* allocates heap space for a DepartmentVector and 
- * (initially) ten Departments in contiguous memory
+ * its first chunk of DEPARTMENT_CHUNK_SIZE Departments
  * initializes the data elements of the
  * DepartmentVector including its numDeps at zero,
- * its capacity at ten, and its pointer to the
- * list's Departments, *departments
+ * its capacity at one chunk, its chunk pointers,
+ * and an empty name index
  */
 DepartmentVector* initDepartmentVector();
 
+/*
+ * frees a DepartmentVector, its chunks, its
+ * name index, and each Department's Vector -
+ * the Departments' pooled names are not freed
+ *
+ * depListPtr - pointer to the DepartmentVector
+ * to free
+ */
+void freeDepartmentVector(DepartmentVector* depListPtr);
+
 
 /*
  * adds a Department to the DepartmentVector pointer
  * passed as an argument
  * increments the DeparmentVector's numDeps for each
- * Department and increases the DepartmentVector's 
- * list capacity as needed
+ * Department, indexes the Department's name, and
+ * allocates a new chunk as needed - no Department
+ * already added is moved
  *
  * depListPtr - pointer to the DeparmentVector
  * to which we want to add a Department
@@ -56,7 +90,42 @@ DepartmentVector* initDepartmentVector();
 void addDepartment(DepartmentVector* depListPtr, Department* departmentPtr);
 
 /*
- * searches every Department in the given DepartmentVector
+ * allocates chunks, in one step, so that the
+ * DepartmentVector can hold at least
+ * minCapacity Departments
+ *
+ * depListPtr - pointer to the DepartmentVector
+ * to grow
+ *
+ * minCapacity - number of Departments the
+ * DepartmentVector must have room for
+ */
+void reserveDepartmentVector(DepartmentVector* depListPtr, unsigned int minCapacity);
+
+/*
+ * frees the DepartmentVector's empty chunks,
+ * keeping at least one, and its unused chunk
+ * pointers - no Department is moved
+ *
+ * depListPtr - pointer to the DepartmentVector
+ * to shrink
+ */
+void shrinkDepartmentVectorToFit(DepartmentVector* depListPtr);
+
+/*
+ * returns a pointer to the Department at the
+ * given position of the DepartmentVector, in
+ * the order the Departments were added, or
+ * NULL if there is no Department there
+ *
+ * depListPtr - pointer to the DepartmentVector
+ *
+ * index - position of the Department
+ */
+Department* getDepartmentAt(DepartmentVector* depListPtr, unsigned int index);
+
+/*
+ * searches the given DepartmentVector's name index
  * for a Department with the given Department name
  * if the Department is found in the DepartmentVector, 
  * then a pointer to that Department is returned
@@ -10,6 +10,7 @@
 #include <string.h>
 
 #include "fileIO.h"
+#include "prereqClosure.h"
 
 #define MAX_NUM_CHARS 100
 #define MAX_NUM_LINES 500
@@ -115,6 +116,10 @@ int fileParser(char ***lines, char *fileName) {
  * loads the Student's completed Courses as
  * Course pointers into the Student's Vector
  * of Elements
+ *
+ * once every file is loaded, each Student's
+ * Degree pointer is resolved - whether the
+ * Student or its Degree was read first
  */
 void handleCommandLineFileInput(int argc, char **argv, CourseBinaryTree *courseTreePtr, DepartmentVector *depListPtr, DegreeVector *degListPtr, StudentBinaryTree *studentTreePtr) {
 
@@ -193,11 +198,25 @@ void handleCommandLineFileInput(int argc, char **argv, CourseBinaryTree *courseT
 			// load data into structure
 			Student *newStuPtr = loadStudent(lines, numLinesInFile, courseTreePtr);
 			insertInStudentBinaryTree(studentTreePtr, newStuPtr);	
+			// linking the Student to its Degree, if
+			// the Degree was loaded first
+			getStudentDegree(newStuPtr, degListPtr);
 		} else {
 
 			printf("\nInput file missing header\n");
 
 		}
 	}
+	// releasing unused chunks now that every file is
+	// loaded - the Degrees themselves do not move
+	shrinkDepartmentVectorToFit(depListPtr);
+	shrinkDegreeVectorToFit(degListPtr);
+	// linking Students loaded before their Degree
+	resolveAllStudentDegrees(studentTreePtr, degListPtr);
+	// every prerequisite is compiled now, so the prerequisite
+	// graph is checked and each Course's transitive
+	// prerequisites are gathered once, in topological order
+	printPrereqGraphProblems(courseTreePtr);
+	computeAllPrereqClosures(courseTreePtr);
 	return;
 }
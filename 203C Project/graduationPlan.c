@@ -0,0 +1,430 @@
+/*
+ *
+ *	C source file containing the implementation of
+ *	the GraduationPlan ADT
+ *
+ *	Go to header file for more information
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "graduationPlan.h"
+#include "prereqClosure.h"
+
+/*
+ * countCoursesLeft() takes a CourseBinaryTree pointer, a
+ * Course id, and BitSet pointers of completed and already
+ * chosen Course ids as arguments
+ *
+ * countCoursesLeft() returns zero for a Course that is
+ * completed or chosen, and otherwise one for the Course
+ * plus the Courses of its prerequisite closure that are
+ * not completed
+ */
+unsigned int countCoursesLeft(CourseBinaryTree *bt, unsigned int courseId, BitSet *completedPtr, BitSet *chosenPtr) {
+
+	if ( testBit(completedPtr, courseId) || testBit(chosenPtr, courseId) ) {
+		return 0;
+	}
+	BitSet *closurePtr = getPrereqClosure(bt, findCourseById(bt, courseId));
+	return 1 + countBits(closurePtr) - countBitsInIntersection(closurePtr, completedPtr);
+}
+
+/*
+ * chooseCheapestCourse() takes a CourseBinaryTree pointer,
+ * an array of alternative Course ids and its length, and
+ * BitSet pointers of completed and chosen Course ids as
+ * arguments and returns the alternative with the fewest
+ * Courses left (the first of equals)
+ */
+unsigned int chooseCheapestCourse(CourseBinaryTree *bt, unsigned int *courseIds, unsigned int numIds, BitSet *completedPtr, BitSet *chosenPtr) {
+
+	unsigned int cheapestId = courseIds[0];
+	unsigned int cheapestCost = countCoursesLeft(bt, cheapestId, completedPtr, chosenPtr);
+	for (unsigned int i = 1; i < numIds; i++) {
+		unsigned int cost = countCoursesLeft(bt, courseIds[i], completedPtr, chosenPtr);
+		if (cost < cheapestCost) {
+			cheapestId = courseIds[i];
+			cheapestCost = cost;
+		}
+	}
+	return cheapestId;
+}
+
+/*
+ * isClauseFulfilled() takes an array of a clause's Course
+ * ids and its length, and BitSet pointers of completed
+ * and chosen Course ids as arguments and returns true if
+ * any Course of the clause is completed or chosen
+ */
+bool isClauseFulfilled(unsigned int *courseIds, unsigned int numIds, BitSet *completedPtr, BitSet *chosenPtr) {
+
+	for (unsigned int i = 0; i < numIds; i++) {
+		if ( testBit(completedPtr, courseIds[i]) || testBit(chosenPtr, courseIds[i]) ) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/*
+ * chooseCourseAndPrerequisites() takes a CourseBinaryTree
+ * pointer, a Course id, BitSet pointers of completed and
+ * chosen Course ids, and a pointer to a growable stack of
+ * Course ids with its capacity as arguments
+ *
+ * chooseCourseAndPrerequisites() chooses the Course and,
+ * for each prerequisite clause that is not yet fulfilled,
+ * the cheapest alternative - working from the stack in
+ * place of recursion
+ */
+void chooseCourseAndPrerequisites(CourseBinaryTree *bt, unsigned int courseId, BitSet *completedPtr, BitSet *chosenPtr, unsigned int **stackPtr, unsigned int *stackCapacity) {
+
+	unsigned int stackTop = 0;
+	(*stackPtr)[stackTop++] = courseId;
+	while (stackTop > 0) {
+		unsigned int id = (*stackPtr)[--stackTop];
+		if ( testBit(completedPtr, id) || testBit(chosenPtr, id) ) {
+			continue;
+		}
+		setBit(chosenPtr, id);
+
+		PrereqExpr *exprPtr = findCourseById(bt, id)->prereqExpr;
+		if (exprPtr == NULL) {
+			continue;
+		}
+		// making room for one Course per clause
+		if (stackTop + exprPtr->numClauses > *stackCapacity) {
+			*stackCapacity = (stackTop + exprPtr->numClauses) * 2;
+			*stackPtr = (unsigned int*) realloc(*stackPtr, *stackCapacity * sizeof(unsigned int));
+		}
+		unsigned int *clauseEnds = prereqClauseEnds(exprPtr);
+		unsigned int *courseIds = prereqCourseIds(exprPtr);
+		unsigned int clauseStart = 0;
+		for (unsigned int i = 0; i < exprPtr->numClauses; i++) {
+			unsigned int numIds = clauseEnds[i] - clauseStart;
+			if ( numIds > 0 && !isClauseFulfilled(courseIds + clauseStart, numIds, completedPtr, chosenPtr) ) {
+				(*stackPtr)[stackTop++] = chooseCheapestCourse(bt, courseIds + clauseStart, numIds, completedPtr, chosenPtr);
+			}
+			clauseStart = clauseEnds[i];
+		}
+	}
+	return;
+}
+
+// a binary heap of positions in the topologically ordered
+// array of chosen Course ids - the Course with the longest
+// chain waiting on it is on top, the earliest first among
+// equals
+typedef struct planHeap {
+	unsigned int *positions;
+	unsigned int numEntries;
+	unsigned int *chosenIds;
+	unsigned int *chainLength;
+} PlanHeap;
+
+/*
+ * comesFirstInPlanHeap() takes a PlanHeap pointer and two
+ * positions as arguments and returns true if the first
+ * position should be taken before the second
+ */
+bool comesFirstInPlanHeap(PlanHeap *heapPtr, unsigned int first, unsigned int second) {
+
+	unsigned int firstChain = heapPtr->chainLength[ heapPtr->chosenIds[first] ];
+	unsigned int secondChain = heapPtr->chainLength[ heapPtr->chosenIds[second] ];
+	return firstChain > secondChain || (firstChain == secondChain && first < second);
+}
+
+/*
+ * pushPlanHeap() takes a PlanHeap pointer and a position as
+ * arguments and adds the position, sifting it up
+ */
+void pushPlanHeap(PlanHeap *heapPtr, unsigned int position) {
+
+	unsigned int i = heapPtr->numEntries++;
+	while (i > 0 && comesFirstInPlanHeap(heapPtr, position, heapPtr->positions[(i - 1) / 2])) {
+		heapPtr->positions[i] = heapPtr->positions[(i - 1) / 2];
+		i = (i - 1) / 2;
+	}
+	heapPtr->positions[i] = position;
+	return;
+}
+
+/*
+ * popPlanHeap() takes a non-empty PlanHeap pointer as an
+ * argument, removes the top position, sifting the last
+ * one down in its place, and returns it
+ */
+unsigned int popPlanHeap(PlanHeap *heapPtr) {
+
+	unsigned int top = heapPtr->positions[0];
+	unsigned int last = heapPtr->positions[--heapPtr->numEntries];
+	unsigned int i = 0;
+	while (2 * i + 1 < heapPtr->numEntries) {
+		unsigned int child = 2 * i + 1;
+		if ( child + 1 < heapPtr->numEntries && comesFirstInPlanHeap(heapPtr, heapPtr->positions[child + 1], heapPtr->positions[child]) ) {
+			child++;
+		}
+		if ( !comesFirstInPlanHeap(heapPtr, heapPtr->positions[child], last) ) {
+			break;
+		}
+		heapPtr->positions[i] = heapPtr->positions[child];
+		i = child;
+	}
+	heapPtr->positions[i] = last;
+	return top;
+}
+
+/*
+ * planGraduation() takes a CourseBinaryTree pointer, a
+ * RequirementGroups pointer, a BitSet pointer of completed
+ * Course ids, and the most Courses in one term as arguments
+ *
+ * planGraduation() chooses the cheapest Course of every
+ * unfulfilled requirement group and the prerequisites it
+ * needs, finds for each chosen Course the longest chain of
+ * chosen Courses that waits on it by walking the
+ * PrereqGraph's topological order backwards, and then
+ * fills one term at a time with the Courses whose
+ * prerequisites are taken, longest chain first - after
+ * each term only the chosen Courses waiting on that
+ * term's Courses are checked again
+ *
+ * Courses that can never be taken are put after the last
+ * term and the plan is marked not complete
+ *
+ * returns NULL for error
+ */
+GraduationPlan* planGraduation(CourseBinaryTree *bt, RequirementGroups *groupsPtr, BitSet *completedPtr, unsigned int coursesPerTerm) {
+
+	// checking for NULL pointer arguments
+	if (bt == NULL || groupsPtr == NULL || completedPtr == NULL) {
+		printf("\nCannot plan graduation with NULL "
+				"CourseBinaryTree, RequirementGroups, "
+				"or BitSet pointer argument\n");
+		return NULL;
+	}
+	if (coursesPerTerm == 0) {
+		printf("\nCannot plan graduation with no "
+				"Courses per term\n");
+		return NULL;
+	}
+
+	// choosing Courses
+	BitSet *chosenPtr = initBitSet(bt->numCourseIds);
+	unsigned int stackCapacity = 16;
+	unsigned int *stack = (unsigned int*) malloc(stackCapacity * sizeof(unsigned int));
+	for (unsigned int g = 0; g < groupsPtr->numGroups; g++) {
+		unsigned int *groupIds = groupsPtr->courseIds + groupsPtr->groups[g].offset;
+		unsigned int numIds = groupsPtr->groups[g].count;
+		if ( isClauseFulfilled(groupIds, numIds, completedPtr, chosenPtr) ) {
+			continue;
+		}
+		unsigned int courseId = chooseCheapestCourse(bt, groupIds, numIds, completedPtr, chosenPtr);
+		chooseCourseAndPrerequisites(bt, courseId, completedPtr, chosenPtr, &stack, &stackCapacity);
+	}
+	free(stack);
+
+	// listing the chosen Courses in topological order
+	PrereqGraph *graphPtr = getPrereqGraph(bt);
+	unsigned int numChosen = countBits(chosenPtr);
+	unsigned int *chosenIds = (unsigned int*) malloc( (numChosen + 1) * sizeof(unsigned int) );
+	unsigned int n = 0;
+	for (unsigned int i = 0; i < graphPtr->numOrdered; i++) {
+		if ( testBit(chosenPtr, graphPtr->topoOrder[i]) ) {
+			chosenIds[n++] = graphPtr->topoOrder[i];
+		}
+	}
+
+	// longest chain of chosen Courses starting at each
+	// chosen Course - every Course that waits on a Course
+	// comes after it in topological order
+	unsigned int *chainLength = (unsigned int*) calloc(graphPtr->numNodes + 1, sizeof(unsigned int));
+	unsigned int longestChain = 0;
+	for (unsigned int i = numChosen; i > 0; i--) {
+		unsigned int id = chosenIds[i - 1];
+		if (chainLength[id] == 0) {
+			chainLength[id] = 1;
+		}
+		if (chainLength[id] > longestChain) {
+			longestChain = chainLength[id];
+		}
+		for (unsigned int edge = graphPtr->edgeStarts[id]; edge < graphPtr->edgeStarts[id + 1]; edge++) {
+			unsigned int prereqId = graphPtr->edges[edge];
+			if ( testBit(chosenPtr, prereqId) && chainLength[prereqId] < chainLength[id] + 1 ) {
+				chainLength[prereqId] = chainLength[id] + 1;
+			}
+		}
+	}
+
+	// allocating heap space
+	GraduationPlan *planPtr = (GraduationPlan*) malloc(sizeof(GraduationPlan));
+	// filling in data members
+	planPtr->numTerms = 0;
+	planPtr->termStarts = (unsigned int*) malloc( (numChosen + 2) * sizeof(unsigned int) );
+	planPtr->termStarts[0] = 0;
+	planPtr->numCourses = numChosen;
+	planPtr->courses = (Course**) malloc( (numChosen + 1) * sizeof(Course*) );
+	planPtr->lowerBound = (numChosen + coursesPerTerm - 1) / coursesPerTerm;
+	if (longestChain > planPtr->lowerBound) {
+		planPtr->lowerBound = longestChain;
+	}
+	planPtr->complete = true;
+
+	// positions of the chosen Courses, and the chosen Courses
+	// that wait on each one, so only those are checked again
+	// after it is taken
+	unsigned int *positionOf = (unsigned int*) malloc( (graphPtr->numNodes + 1) * sizeof(unsigned int) );
+	for (unsigned int i = 0; i < numChosen; i++) {
+		positionOf[ chosenIds[i] ] = i;
+	}
+	unsigned int *waitingStarts = (unsigned int*) calloc(numChosen + 2, sizeof(unsigned int));
+	for (unsigned int i = 0; i < numChosen; i++) {
+		unsigned int id = chosenIds[i];
+		for (unsigned int edge = graphPtr->edgeStarts[id]; edge < graphPtr->edgeStarts[id + 1]; edge++) {
+			if ( testBit(chosenPtr, graphPtr->edges[edge]) ) {
+				waitingStarts[ positionOf[graphPtr->edges[edge]] + 2 ]++;
+			}
+		}
+	}
+	for (unsigned int i = 2; i < numChosen + 2; i++) {
+		waitingStarts[i] += waitingStarts[i - 1];
+	}
+	unsigned int *waiting = (unsigned int*) malloc( (waitingStarts[numChosen + 1] + 1) * sizeof(unsigned int) );
+	for (unsigned int i = 0; i < numChosen; i++) {
+		unsigned int id = chosenIds[i];
+		for (unsigned int edge = graphPtr->edgeStarts[id]; edge < graphPtr->edgeStarts[id + 1]; edge++) {
+			if ( testBit(chosenPtr, graphPtr->edges[edge]) ) {
+				waiting[ waitingStarts[ positionOf[graphPtr->edges[edge]] + 1 ]++ ] = i;
+			}
+		}
+	}
+
+	// filling terms from a heap of the Courses whose
+	// prerequisites are taken, longest chain first
+	BitSet *takenPtr = initBitSet(bt->numCourseIds);
+	unionBits(takenPtr, completedPtr);
+	bool *queued = (bool*) calloc(numChosen + 1, sizeof(bool));
+	PlanHeap heap = { (unsigned int*) malloc( (numChosen + 1) * sizeof(unsigned int) ), 0, chosenIds, chainLength };
+	for (unsigned int i = 0; i < numChosen; i++) {
+		if ( evaluatePrereqExpr(bt->coursesById[ chosenIds[i] ]->prereqExpr, takenPtr) ) {
+			pushPlanHeap(&heap, i);
+			queued[i] = true;
+		}
+	}
+	unsigned int numPlanned = 0;
+	while (numPlanned < numChosen) {
+		if (heap.numEntries == 0) {
+			planPtr->complete = false;
+			break;
+		}
+
+		unsigned int termStart = numPlanned;
+		while (heap.numEntries > 0 && numPlanned - termStart < coursesPerTerm) {
+			planPtr->courses[numPlanned++] = bt->coursesById[ chosenIds[popPlanHeap(&heap)] ];
+		}
+		for (unsigned int k = termStart; k < numPlanned; k++) {
+			setBit(takenPtr, planPtr->courses[k]->id);
+		}
+		// checking the Courses waiting on this term's Courses
+		for (unsigned int k = termStart; k < numPlanned; k++) {
+			unsigned int position = positionOf[ planPtr->courses[k]->id ];
+			for (unsigned int w = waitingStarts[position]; w < waitingStarts[position + 1]; w++) {
+				unsigned int waitingPosition = waiting[w];
+				if ( !queued[waitingPosition] && evaluatePrereqExpr(bt->coursesById[ chosenIds[waitingPosition] ]->prereqExpr, takenPtr) ) {
+					pushPlanHeap(&heap, waitingPosition);
+					queued[waitingPosition] = true;
+				}
+			}
+		}
+		planPtr->numTerms++;
+		planPtr->termStarts[planPtr->numTerms] = numPlanned;
+	}
+
+	// Courses that can never be taken
+	for (unsigned int i = 0; i < numChosen && numPlanned < numChosen; i++) {
+		if ( !testBit(takenPtr, chosenIds[i]) ) {
+			planPtr->courses[numPlanned++] = bt->coursesById[ chosenIds[i] ];
+		}
+	}
+
+	free(heap.positions);
+	free(queued);
+	free(waiting);
+	free(waitingStarts);
+	free(positionOf);
+	free(chainLength);
+	free(chosenIds);
+	freeBitSet(takenPtr);
+	freeBitSet(chosenPtr);
+	return planPtr;
+}
+
+/*
+ * freeGraduationPlan() takes a GraduationPlan pointer as
+ * an argument and frees its arrays and the GraduationPlan
+ */
+void freeGraduationPlan(GraduationPlan *planPtr) {
+
+	if (planPtr == NULL) {
+		return;
+	}
+	free(planPtr->termStarts);
+	free(planPtr->courses);
+	free(planPtr);
+	return;
+}
+
+/*
+ * printCourseNames() takes an array of Course pointers and
+ * the range of it to print as arguments and prints the
+ * Course names separated by commas
+ */
+void printCourseNames(Course **courses, unsigned int first, unsigned int last) {
+
+	for (unsigned int i = first; i < last; i++) {
+		if (i > first) {
+			printf(", ");
+		}
+		printf("%s", courses[i]->name);
+	}
+	printf("\n");
+	return;
+}
+
+/*
+ * printGraduationPlan() takes a GraduationPlan pointer as
+ * an argument and prints each term's Courses on one line,
+ * the Courses that cannot be taken, if any, and the
+ * number of terms against the lower bound
+ */
+void printGraduationPlan(GraduationPlan *planPtr) {
+
+	// checking for NULL pointer argument
+	if (planPtr == NULL) {
+		printf("\nCannot print GraduationPlan "
+				"with NULL GraduationPlan "
+				"pointer argument\n");
+		return;
+	}
+
+	printf("\n");
+	for (unsigned int t = 0; t < planPtr->numTerms; t++) {
+		printf("Term %u: ", t + 1);
+		printCourseNames(planPtr->courses, planPtr->termStarts[t], planPtr->termStarts[t + 1]);
+	}
+	if (!planPtr->complete) {
+		printf("Prerequisites never fulfilled: ");
+		printCourseNames(planPtr->courses, planPtr->termStarts[planPtr->numTerms], planPtr->numCourses);
+		return;
+	}
+	printf("%u terms", planPtr->numTerms);
+	if (planPtr->numTerms == planPtr->lowerBound) {
+		printf(" (the fewest possible)\n");
+	} else {
+		printf(" (no plan takes fewer than %u)\n", planPtr->lowerBound);
+	}
+	return;
+}
@@ -0,0 +1,99 @@
+/*
+ *
+ *	Header file for the GraduationPlan ADT interface
+ *
+ *	A GraduationPlan splits the Courses a Student still
+ *	needs for his or her Degree into terms of at most a
+ *	given number of Courses, so that every Course is in
+ *	a later term than the prerequisites it needs.
+ *
+ *	The plan is made in two steps:
+ *		choosing Courses - for every requirement group
+ *		that is not fulfilled, and then for every
+ *		prerequisite clause that is not fulfilled, the
+ *		alternative with the fewest Courses left in its
+ *		prerequisite closure (see prereqClosure.h) is
+ *		chosen, and its own prerequisites after it
+ *		scheduling - each term takes the chosen Courses
+ *		whose prerequisites are fulfilled by the earlier
+ *		terms, those with the longest chain of chosen
+ *		Courses waiting on them first
+ *	Prerequisites are checked with the compiled
+ *	PrereqExpr against a BitSet of the Courses taken so
+ *	far, so disjunct prerequisites are fulfilled by any
+ *	one of their Courses.
+ *
+ *	Finding the fewest possible terms with a cap on
+ *	Courses per term is NP-hard in general, so the plan
+ *	is a heuristic. It never takes fewer terms than
+ *	lowerBound - the longest chain of chosen Courses, or
+ *	the number of chosen Courses divided by the cap -
+ *	and when it takes exactly that many it is known to
+ *	be the fewest.
+ *
+ *	A plan is not complete when some chosen Course can
+ *	never be taken, such as a Course on a prerequisite
+ *	cycle.
+ *
+ */
+
+#ifndef GRADUATIONPLAN_H
+#define GRADUATIONPLAN_H
+
+#include "courseBT.h"
+#include "requirementGroups.h"
+#include "bitSet.h"
+
+// Courses per term when none is given
+#define DEFAULT_COURSES_PER_TERM 4
+
+// struct for a term-by-term plan
+//
+// term t is courses[termStarts[t]] up to (not including)
+// courses[termStarts[t + 1]] - Courses that can never be
+// taken follow the last term, up to numCourses
+typedef struct graduationPlan {
+	unsigned int numTerms;
+	unsigned int *termStarts;
+	unsigned int numCourses;
+	Course **courses;
+	unsigned int lowerBound;
+	bool complete;
+} GraduationPlan;
+
+
+// GraduationPlan interface
+
+/*
+ * builds a plan for the requirement groups not
+ * fulfilled by the completed Courses and returns
+ * a pointer to it
+ *
+ * bt - pointer to the CourseBinaryTree of every
+ * Course
+ *
+ * groupsPtr - pointer to the Degree's
+ * RequirementGroups
+ *
+ * completedPtr - pointer to the BitSet of
+ * completed Course ids
+ *
+ * coursesPerTerm - most Courses in one term
+ */
+GraduationPlan* planGraduation(CourseBinaryTree* bt, RequirementGroups* groupsPtr, BitSet* completedPtr, unsigned int coursesPerTerm);
+
+/*
+ * frees a GraduationPlan and its arrays
+ *
+ * planPtr - pointer to the GraduationPlan to free
+ */
+void freeGraduationPlan(GraduationPlan* planPtr);
+
+/*
+ * prints a GraduationPlan one term per line
+ *
+ * planPtr - pointer to the GraduationPlan to print
+ */
+void printGraduationPlan(GraduationPlan* planPtr);
+
+#endif
@@ -12,9 +12,13 @@
 #include "fileIO.h"
 
 #include "courseBT.h"
+#include "prereqGraph.h"
 #include "departmentVector.h"
 #include "degreeVector.h"
 #include "studentBT.h"
+#include "completionStore.h"
+#include "auditCache.h"
+#include "stringPool.h"
 
 #include "userInterface.h"
 
@@ -29,6 +33,10 @@ int main(int argc, char *argv[]) {
 	DegreeVector *degListPtr = initDegreeVector();
 	// initialize student tree
 	StudentBinaryTree *studentTree = createStudentBinaryTree();
+	// initialize (empty) completion store - built on first use
+	CompletionStore *completionStore = initCompletionStore();
+	// initialize (empty) cache of m and n results
+	AuditCache *auditCache = initAuditCache(AUDIT_CACHE_COST_LIMIT);
 
 		
 
@@ -38,12 +46,12 @@ int main(int argc, char *argv[]) {
 
 	// printing the departments, degrees, and students passed into the program	
 	for (int i = 0; i < depListPtr->numDeps; ++i) {
-		printDepartment(depListPtr->departments + i);
+		printDepartment(getDepartmentAt(depListPtr, i));
 	}
 
 	
 	for (int j = 0; j < degListPtr->numDegs; ++j) {
-		printDegree(degListPtr->degrees + j);
+		printDegree(getDegreeAt(degListPtr, j));
 	}
 
 	printStudentBinaryTreeInOrder(studentTree->root);
@@ -53,43 +61,38 @@ int main(int argc, char *argv[]) {
 	char firstChar;
 	do {
 		userInput = NULL;
-		printf("\nEnter a command (c, d, s, a, m, n, r, p, q, x)\n");
-		printf("p takes an additional command: (p) c, d, g, s\n\n");
+		printf("\nEnter a command (c, d, s, a, m, n, r, p, q, t, e, g, w, v, b, k, j, i, x)\n");
+		printf("p takes an additional command: (p) c, d, g, s\n");
+		printf("t takes an additional command: (t) a, c, d, b\n\n");
 		firstChar = getUserInput(&userInput);
-		processUserInput(firstChar, &userInput, courseTree, depListPtr, degListPtr, studentTree);
+		processUserInput(firstChar, &userInput, courseTree, depListPtr, degListPtr, studentTree, completionStore, auditCache);
 		free(userInput);
 	} while(firstChar != 'x');
 
 	// freeing heap space
 
-	free(studentTree);
-	studentTree = NULL;
+	freeCompletionStore(completionStore);
+	completionStore = NULL;
 
-	free(depListPtr->departments->depCourses->elements);
-	depListPtr->departments->depCourses->elements = NULL;
+	freeAuditCache(auditCache);
+	auditCache = NULL;
 
-	free(depListPtr->departments->depCourses);
-	depListPtr->departments->depCourses = NULL;
-	
-	free(depListPtr->departments);
-	depListPtr->departments = NULL;
+	freeStudentBinaryTree(studentTree);
+	studentTree = NULL;
 
-	free(depListPtr);
+	freeDepartmentVector(depListPtr);
 	depListPtr = NULL;
 
-	free(degListPtr->degrees->reqCourses->elements);
-	degListPtr->degrees->reqCourses->elements = NULL;
-
-	free(degListPtr->degrees->reqCourses);	
-	degListPtr->degrees->reqCourses = NULL;
-
-	free(degListPtr->degrees);
-	degListPtr->degrees = NULL;
-
-	free(degListPtr);
+	freeDegreeVector(degListPtr);
 	degListPtr = NULL;
 	
+	freePrereqGraph(courseTree->prereqGraph);
+	courseTree->prereqGraph = NULL;
+
 	free(courseTree);
 	courseTree = NULL;
+
+	// every name is pooled
+	freeStringPool();
 	return 0;
 }
@@ -0,0 +1,161 @@
+/*
+ *
+ *	C source file containing the implementation of
+ *	the NameIndex ADT
+ *
+ *	Go to header file for more information
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "nameIndex.h"
+
+// slots in a new NameIndex
+#define NAME_INDEX_INITIAL_SLOTS 16
+
+/*
+ * initNameIndex() allocates heap space for a NameIndex
+ * with NAME_INDEX_INITIAL_SLOTS empty slots and returns
+ * a pointer to it
+ */
+NameIndex* initNameIndex() {
+
+	// allocating heap space
+	NameIndex *indexPtr = (NameIndex*) malloc(sizeof(NameIndex));
+	// filling in data members
+	indexPtr->numNames = 0;
+	indexPtr->numSlots = NAME_INDEX_INITIAL_SLOTS;
+	indexPtr->slots = (NameSlot*) calloc(indexPtr->numSlots, sizeof(NameSlot));
+	return indexPtr;
+}
+
+/*
+ * freeNameIndex() takes a NameIndex pointer as an
+ * argument and frees its slots and the NameIndex - the
+ * names belong to the indexed records
+ */
+void freeNameIndex(NameIndex *indexPtr) {
+
+	if (indexPtr == NULL) {
+		return;
+	}
+	free(indexPtr->slots);
+	free(indexPtr);
+	return;
+}
+
+/*
+ * hashName() takes a name string as an argument and
+ * returns its 32-bit FNV-1a hash
+ */
+unsigned int hashName(char *name) {
+
+	unsigned int hash = 2166136261u;
+	for (unsigned char *c = (unsigned char*) name; *c != '\0'; c++) {
+		hash ^= *c;
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+/*
+ * findSlot() takes a NameIndex pointer, a name string,
+ * and the name's hash as arguments and returns the slot
+ * holding the name, or the empty slot it would go in
+ */
+NameSlot* findSlot(NameIndex *indexPtr, char *name, unsigned int hash) {
+
+	unsigned int mask = indexPtr->numSlots - 1;
+	unsigned int s = hash & mask;
+	while (indexPtr->slots[s].name != NULL) {
+		NameSlot *slotPtr = &(indexPtr->slots[s]);
+		// a pooled name (see stringPool.h) is the very
+		// string indexed, so no characters are compared
+		if ( slotPtr->name == name || (slotPtr->hash == hash && strcmp(slotPtr->name, name) == 0) ) {
+			return slotPtr;
+		}
+		s = (s + 1) & mask;
+	}
+	return &(indexPtr->slots[s]);
+}
+
+/*
+ * growNameIndex() takes a NameIndex pointer as an
+ * argument, doubles its number of slots, and puts every
+ * name back in with the hash it already has
+ */
+void growNameIndex(NameIndex *indexPtr) {
+
+	NameSlot *oldSlots = indexPtr->slots;
+	unsigned int oldNumSlots = indexPtr->numSlots;
+	indexPtr->numSlots = oldNumSlots * 2;
+	indexPtr->slots = (NameSlot*) calloc(indexPtr->numSlots, sizeof(NameSlot));
+	unsigned int mask = indexPtr->numSlots - 1;
+	for (unsigned int i = 0; i < oldNumSlots; i++) {
+		if (oldSlots[i].name == NULL) {
+			continue;
+		}
+		// every name is distinct, so only an empty slot
+		// needs to be found
+		unsigned int s = oldSlots[i].hash & mask;
+		while (indexPtr->slots[s].name != NULL) {
+			s = (s + 1) & mask;
+		}
+		indexPtr->slots[s] = oldSlots[i];
+	}
+	free(oldSlots);
+	return;
+}
+
+/*
+ * addToNameIndex() takes a NameIndex pointer, a name
+ * string, and a position as arguments
+ *
+ * if the name is not indexed yet, addToNameIndex() puts
+ * it in its slot with the position, growing the
+ * NameIndex first if it would be more than three
+ * quarters full, and returns true
+ *
+ * returns false if the name was already indexed or for
+ * error
+ */
+bool addToNameIndex(NameIndex *indexPtr, char *name, unsigned int position) {
+
+	// checking for NULL pointer arguments
+	if (indexPtr == NULL || name == NULL) {
+		printf("\nCannot add to NameIndex with "
+				"NULL NameIndex or name "
+				"argument\n");
+		return false;
+	}
+
+	if ( (indexPtr->numNames + 1) * 4 > indexPtr->numSlots * 3 ) {
+		growNameIndex(indexPtr);
+	}
+	unsigned int hash = hashName(name);
+	NameSlot *slotPtr = findSlot(indexPtr, name, hash);
+	if (slotPtr->name != NULL) {
+		return false;
+	}
+	slotPtr->name = name;
+	slotPtr->hash = hash;
+	slotPtr->position = position;
+	indexPtr->numNames++;
+	return true;
+}
+
+/*
+ * findInNameIndex() takes a NameIndex pointer and a name
+ * string as arguments and returns the position indexed
+ * for the name, or NAME_NOT_INDEXED
+ */
+unsigned int findInNameIndex(NameIndex *indexPtr, char *name) {
+
+	if (indexPtr == NULL || name == NULL) {
+		return NAME_NOT_INDEXED;
+	}
+	NameSlot *slotPtr = findSlot(indexPtr, name, hashName(name));
+	return (slotPtr->name == NULL) ? NAME_NOT_INDEXED : slotPtr->position;
+}
@@ -0,0 +1,98 @@
+/*
+ *
+ *	Header file for the NameIndex ADT interface
+ *
+ *	A NameIndex finds the position of a name in an array
+ *	of named records - the Degrees of a DegreeVector or
+ *	the Departments of a DepartmentVector - without
+ *	comparing the name against every record.
+ *
+ *	Names are kept in an open-addressed hash table with
+ *	linear probing. Each slot holds the name's hash, a
+ *	pointer to the record's own name string, and the
+ *	record's position, so a lookup only calls strcmp()
+ *	on a name whose full hash matches, and not even
+ *	then if the name is the indexed string itself. The
+ *	table is doubled once it is three quarters full.
+ *
+ *	Only the first record with a name is indexed, as a
+ *	search from the front of the array would find. The
+ *	name strings are not copied, so they must live as
+ *	long as the NameIndex.
+ *
+ */
+
+#ifndef NAMEINDEX_H
+#define NAMEINDEX_H
+
+#include <stdbool.h>
+
+// position returned for a name that is not indexed
+#define NAME_NOT_INDEXED 0xFFFFFFFFu
+
+// struct for one slot of a NameIndex - name is NULL
+// for an empty slot
+typedef struct nameSlot {
+	char *name;
+	unsigned int hash;
+	unsigned int position;
+} NameSlot;
+
+// struct for the hash table of a NameIndex - numSlots
+// is a power of two
+typedef struct nameIndex {
+	unsigned int numNames;
+	unsigned int numSlots;
+	NameSlot *slots;
+} NameIndex;
+
+
+// NameIndex interface
+
+/*
+ * allocates heap space for an empty
+ * NameIndex and returns a pointer to it
+ */
+NameIndex* initNameIndex();
+
+/*
+ * frees a NameIndex and its table, but not
+ * the names
+ *
+ * indexPtr - pointer to the NameIndex to
+ * free
+ */
+void freeNameIndex(NameIndex* indexPtr);
+
+/*
+ * returns the hash of a name string
+ *
+ * name - string to hash
+ */
+unsigned int hashName(char* name);
+
+/*
+ * indexes a name at a position, unless the
+ * name is already indexed, and returns true
+ * if it was added
+ *
+ * indexPtr - pointer to the NameIndex
+ *
+ * name - the record's name string
+ *
+ * position - the record's position in its
+ * array
+ */
+bool addToNameIndex(NameIndex* indexPtr, char* name, unsigned int position);
+
+/*
+ * returns the position indexed for a name,
+ * or NAME_NOT_INDEXED if it is not indexed
+ *
+ * indexPtr - pointer to the NameIndex
+ *
+ * name - string name to find
+ */
+unsigned int findInNameIndex(NameIndex* indexPtr, char* name);
+
+#endif
@@ -0,0 +1,326 @@
+/*
+ *
+ *	C source file containing the implementation of
+ *	the transitive prerequisite closures of Courses
+ *
+ *	Go to header file for more information
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "prereqClosure.h"
+
+/*
+ * computeComponentClosure() takes a CourseBinaryTree pointer,
+ * its PrereqGraph pointer, and the index of a component of
+ * the graph as arguments
+ *
+ * computeComponentClosure() builds one closure for the whole
+ * component - every prerequisite of its Courses, and the
+ * closure of every prerequisite outside the component, which
+ * comes earlier in topological order and is already current
+ *
+ * every Course of a cycle requires every other, so each
+ * member is given a copy of the same closure
+ */
+void computeComponentClosure(CourseBinaryTree *bt, PrereqGraph *graphPtr, unsigned int component) {
+
+	unsigned int first = graphPtr->componentStarts[component];
+	unsigned int last = graphPtr->componentStarts[component + 1];
+	Course *firstPtr = bt->coursesById[ graphPtr->topoOrder[first] ];
+	if (firstPtr->prereqClosure == NULL) {
+		firstPtr->prereqClosure = initBitSet(bt->numCourseIds);
+	} else {
+		clearAllBits(firstPtr->prereqClosure);
+	}
+
+	for (unsigned int i = first; i < last; i++) {
+		unsigned int id = graphPtr->topoOrder[i];
+		for (unsigned int edge = graphPtr->edgeStarts[id]; edge < graphPtr->edgeStarts[id + 1]; edge++) {
+			unsigned int prereqId = graphPtr->edges[edge];
+			setBit(firstPtr->prereqClosure, prereqId);
+			if (graphPtr->componentOf[prereqId] != component) {
+				unionBits(firstPtr->prereqClosure, bt->coursesById[prereqId]->prereqClosure);
+			}
+		}
+	}
+	firstPtr->closureState = CLOSURE_CURRENT;
+
+	for (unsigned int i = first + 1; i < last; i++) {
+		Course *memberPtr = bt->coursesById[ graphPtr->topoOrder[i] ];
+		if (memberPtr->prereqClosure == NULL) {
+			memberPtr->prereqClosure = initBitSet(bt->numCourseIds);
+		} else {
+			clearAllBits(memberPtr->prereqClosure);
+		}
+		unionBits(memberPtr->prereqClosure, firstPtr->prereqClosure);
+		memberPtr->closureState = CLOSURE_CURRENT;
+	}
+	return;
+}
+
+/*
+ * refreshPrereqClosures() takes a CourseBinaryTree pointer
+ * as an argument and walks the components of the tree's
+ * PrereqGraph in topological order, computing again every
+ * component with a stale Course
+ */
+void refreshPrereqClosures(CourseBinaryTree *bt) {
+
+	PrereqGraph *graphPtr = getPrereqGraph(bt);
+	for (unsigned int c = 0; c < graphPtr->numComponents; c++) {
+		bool stale = false;
+		for (unsigned int i = graphPtr->componentStarts[c]; i < graphPtr->componentStarts[c + 1]; i++) {
+			stale = stale || bt->coursesById[ graphPtr->topoOrder[i] ]->closureState == CLOSURE_STALE;
+		}
+		if (stale) {
+			computeComponentClosure(bt, graphPtr, c);
+		}
+	}
+	return;
+}
+
+/*
+ * getPrereqClosure() takes a CourseBinaryTree pointer and
+ * a Course pointer as arguments
+ *
+ * getPrereqClosure() returns the Course's closure, first
+ * refreshing the stale closures if the Course's is stale
+ *
+ * returns NULL for error
+ */
+BitSet* getPrereqClosure(CourseBinaryTree *bt, Course *coursePtr) {
+
+	// checking for NULL pointer arguments
+	if (bt == NULL || coursePtr == NULL) {
+		printf("\nCannot get a prerequisite closure "
+				"with NULL CourseBinaryTree or "
+				"Course pointer argument\n");
+		return NULL;
+	}
+
+	if (coursePtr->closureState == CLOSURE_STALE) {
+		refreshPrereqClosures(bt);
+	}
+	return coursePtr->prereqClosure;
+}
+
+/*
+ * computeAllPrereqClosures() takes a CourseBinaryTree
+ * pointer as an argument, marks every Course's closure
+ * stale, and then computes every closure in topological
+ * order, each once
+ */
+void computeAllPrereqClosures(CourseBinaryTree *bt) {
+
+	// checking for NULL pointer argument
+	if (bt == NULL) {
+		printf("\nCannot compute prerequisite closures "
+				"with NULL CourseBinaryTree pointer "
+				"argument\n");
+		return;
+	}
+
+	for (unsigned int id = 0; id < bt->numCourseIds; id++) {
+		Course *coursePtr = findCourseById(bt, id);
+		if (coursePtr != NULL) {
+			coursePtr->closureState = CLOSURE_STALE;
+		}
+	}
+	refreshPrereqClosures(bt);
+	return;
+}
+
+/*
+ * updatePrereqClosures() takes a CourseBinaryTree pointer
+ * and a BitSet pointer of changed Course ids as arguments
+ *
+ * updatePrereqClosures() marks stale every changed Course
+ * and every Course that requires one of them, directly or
+ * through other Courses - found by following the Courses'
+ * back-references (dependents) from the changed Courses
+ * with a stack, each Course once - and then computes the
+ * stale closures again in topological order
+ *
+ * a Course that requires a changed Course only through a
+ * Course whose prerequisites also changed is reached from
+ * that Course, so the back-references are enough even
+ * though the changed Courses' own were just rebuilt
+ */
+void updatePrereqClosures(CourseBinaryTree *bt, BitSet *changedIds) {
+
+	// checking for NULL pointer arguments
+	if (bt == NULL || changedIds == NULL) {
+		printf("\nCannot update prerequisite closures "
+				"with NULL CourseBinaryTree or "
+				"BitSet pointer argument\n");
+		return;
+	}
+
+	BitSet *markedIds = initBitSet(bt->numCourseIds);
+	unsigned int stackCapacity = 16;
+	Course **stack = (Course**) malloc(stackCapacity * sizeof(Course*));
+	unsigned int stackTop = 0;
+	for (unsigned int w = 0; w < changedIds->numWords; w++) {
+		uint64_t changedBits = changedIds->words[w];
+		while (changedBits != 0) {
+			unsigned int courseId = w * 64 + __builtin_ctzll(changedBits);
+			changedBits &= changedBits - 1;
+			Course *coursePtr = findCourseById(bt, courseId);
+			if (coursePtr == NULL) {
+				continue;
+			}
+			if (stackTop == stackCapacity) {
+				stackCapacity *= 2;
+				stack = (Course**) realloc(stack, stackCapacity * sizeof(Course*));
+			}
+			setBit(markedIds, courseId);
+			stack[stackTop++] = coursePtr;
+		}
+	}
+
+	while (stackTop > 0) {
+		Course *coursePtr = stack[--stackTop];
+		coursePtr->closureState = CLOSURE_STALE;
+		// making room for every dependent
+		if (stackTop + coursePtr->numDependents > stackCapacity) {
+			stackCapacity = (stackTop + coursePtr->numDependents) * 2;
+			stack = (Course**) realloc(stack, stackCapacity * sizeof(Course*));
+		}
+		for (unsigned int d = 0; d < coursePtr->numDependents; d++) {
+			Course *dependentPtr = coursePtr->dependents[d];
+			if ( !testBit(markedIds, dependentPtr->id) ) {
+				setBit(markedIds, dependentPtr->id);
+				stack[stackTop++] = dependentPtr;
+			}
+		}
+	}
+	free(stack);
+	freeBitSet(markedIds);
+
+	refreshPrereqClosures(bt);
+	return;
+}
+
+// a Course whose prerequisites are being gathered, with
+// the clause and term of its PrereqExpr to visit next
+typedef struct ChainFrame {
+	Course *coursePtr;
+	unsigned int clause;
+	unsigned int term;
+} ChainFrame;
+
+/*
+ * gatherPrereqChain() takes a CourseBinaryTree pointer, a
+ * Course pointer, a BitSet pointer of Course ids already
+ * visited, a BitSet pointer of completed Course ids (or
+ * NULL), an array to gather Courses into, and a pointer to
+ * the number of Courses in the array as arguments
+ *
+ * gatherPrereqChain() visits each prerequisite of the
+ * Course once, gathering its own prerequisites first and
+ * then the prerequisite itself
+ *
+ * a clause with a completed Course is already fulfilled,
+ * so none of its Courses - nor what they require - is
+ * gathered
+ *
+ * the Courses being visited are kept on a stack of
+ * ChainFrames rather than the call stack, since a chain
+ * of prerequisites can be as long as there are Courses -
+ * a Course is gathered when its frame is popped, after
+ * every frame pushed above it
+ */
+void gatherPrereqChain(CourseBinaryTree *bt, Course *coursePtr, BitSet *visitedPtr, BitSet *completedPtr, Course **courses, unsigned int *numCourses) {
+
+	unsigned int stackCapacity = 16;
+	ChainFrame *stack = (ChainFrame*) malloc(stackCapacity * sizeof(ChainFrame));
+	unsigned int stackTop = 0;
+	stack[stackTop++] = (ChainFrame) { coursePtr, 0, 0 };
+	while (stackTop > 0) {
+		ChainFrame *framePtr = &stack[stackTop - 1];
+		PrereqExpr *exprPtr = framePtr->coursePtr->prereqExpr;
+		if (exprPtr == NULL || framePtr->clause == exprPtr->numClauses) {
+			// every clause visited - the Course itself is
+			// gathered, unless it is the one the chain is for
+			stackTop--;
+			if (stackTop > 0) {
+				courses[*numCourses] = framePtr->coursePtr;
+				(*numCourses)++;
+			}
+			continue;
+		}
+		unsigned int *clauseEnds = prereqClauseEnds(exprPtr);
+		unsigned int *courseIds = prereqCourseIds(exprPtr);
+		unsigned int clauseStart = (framePtr->clause == 0) ? 0 : clauseEnds[framePtr->clause - 1];
+		if (framePtr->term == clauseStart) {
+			bool fulfilled = false;
+			for (unsigned int term = clauseStart; term < clauseEnds[framePtr->clause]; term++) {
+				fulfilled = fulfilled || testBit(completedPtr, courseIds[term]);
+			}
+			if (fulfilled) {
+				framePtr->term = clauseEnds[framePtr->clause];
+			}
+		}
+		if (framePtr->term == clauseEnds[framePtr->clause]) {
+			framePtr->clause++;
+			continue;
+		}
+		unsigned int prereqId = courseIds[framePtr->term];
+		framePtr->term++;
+		if ( testBit(visitedPtr, prereqId) ) {
+			continue;
+		}
+		setBit(visitedPtr, prereqId);
+		Course *prereqPtr = findCourseById(bt, prereqId);
+		if (prereqPtr == NULL) {
+			continue;
+		}
+		if (stackTop == stackCapacity) {
+			stackCapacity *= 2;
+			stack = (ChainFrame*) realloc(stack, stackCapacity * sizeof(ChainFrame));
+		}
+		stack[stackTop++] = (ChainFrame) { prereqPtr, 0, 0 };
+	}
+	free(stack);
+	return;
+}
+
+/*
+ * prereqChain() takes a CourseBinaryTree pointer, a Course
+ * pointer, and a BitSet pointer of completed Course ids
+ * (or NULL) as arguments
+ *
+ * prereqChain() sizes an array by the Course's closure,
+ * gathers the Course's transitive prerequisites into it
+ * with gatherPrereqChain(), and returns them as a new
+ * Vector
+ *
+ * returns NULL for error
+ */
+Vector* prereqChain(CourseBinaryTree *bt, Course *coursePtr, BitSet *completedPtr) {
+
+	// checking for NULL pointer arguments
+	if (bt == NULL || coursePtr == NULL) {
+		printf("\nCannot build a prerequisite chain "
+				"with NULL CourseBinaryTree or "
+				"Course pointer argument\n");
+		return NULL;
+	}
+
+	BitSet *closurePtr = getPrereqClosure(bt, coursePtr);
+	Course **courses = (Course**) malloc( (countBits(closurePtr) + 1) * sizeof(Course*) );
+	unsigned int numCourses = 0;
+	BitSet *visitedPtr = initBitSet(bt->numCourseIds);
+	// the Course itself is never part of its own chain
+	setBit(visitedPtr, coursePtr->id);
+	gatherPrereqChain(bt, coursePtr, visitedPtr, completedPtr, courses, &numCourses);
+
+	Vector *chainPtr = initVector();
+	emplaceElements(chainPtr, courses, numCourses);
+	free(courses);
+	freeBitSet(visitedPtr);
+	return chainPtr;
+}
@@ -0,0 +1,89 @@
+/*
+ *
+ *	Header file for the prerequisite closure interface
+ *
+ *	Every Course carries a BitSet, prereqClosure, of
+ *	the ids of all of its transitive prerequisites -
+ *	its own prerequisites, their prerequisites, and so
+ *	on. Every Course of a clause counts, so both sides
+ *	of a disjunct prerequisite are in the closure.
+ *
+ *	Closures are computed once after loading, walking the
+ *	Courses in the topological order of the prerequisite
+ *	graph (see prereqGraph.h), so each closure is the union
+ *	of its prerequisites' finished closures and nothing
+ *	is computed twice.
+ *
+ *	When a Course's prerequisites change or Courses are
+ *	removed, only the changed Courses and the Courses
+ *	whose closures contain them are marked stale and
+ *	computed again.
+ *
+ *	The Courses of a prerequisite cycle all require one
+ *	another, so they share one closure, which includes
+ *	the Courses of the cycle themselves.
+ *
+ */
+
+#ifndef PREREQCLOSURE_H
+#define PREREQCLOSURE_H
+
+#include "courseBT.h"
+#include "prereqGraph.h"
+#include "coursePtrVector.h"
+#include "bitSet.h"
+
+// prerequisite closure interface
+
+/*
+ * returns the Course's prerequisite closure,
+ * computing the stale closures first if it
+ * is stale
+ *
+ * bt - pointer to the CourseBinaryTree that
+ * maps Course ids to Courses
+ *
+ * coursePtr - pointer to the Course
+ */
+BitSet* getPrereqClosure(CourseBinaryTree* bt, Course* coursePtr);
+
+/*
+ * computes the prerequisite closure of every
+ * Course on the tree - called once after
+ * loading
+ *
+ * bt - pointer to the CourseBinaryTree
+ */
+void computeAllPrereqClosures(CourseBinaryTree* bt);
+
+/*
+ * computes again the closures of the changed
+ * Courses and of every Course that requires
+ * one of them, leaving every other closure as
+ * it is
+ *
+ * bt - pointer to the CourseBinaryTree
+ *
+ * changedIds - pointer to the BitSet of ids of
+ * the Courses whose prerequisites changed or
+ * that were removed - a Course that required a
+ * removed Course has changed prerequisites too
+ */
+void updatePrereqClosures(CourseBinaryTree* bt, BitSet* changedIds);
+
+/*
+ * returns a new Vector of the Course's transitive
+ * prerequisites, each after its own prerequisites,
+ * leaving out every clause already fulfilled by a
+ * completed Course
+ *
+ * bt - pointer to the CourseBinaryTree
+ *
+ * coursePtr - pointer to the Course
+ *
+ * completedPtr - pointer to the BitSet of
+ * completed Course ids, or NULL for none
+ */
+Vector* prereqChain(CourseBinaryTree* bt, Course* coursePtr, BitSet* completedPtr);
+
+#endif
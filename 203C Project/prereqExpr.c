@@ -0,0 +1,304 @@
+/*
+ *
+ *	C source file containing the implementation of
+ *	the PrereqExpr ADT and of the helpers for the
+ *	prerequisite group strings it is compiled from
+ *
+ *	Go to header file for more information
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "prereqExpr.h"
+
+/*
+ * initPrereqExpr() takes the number of clauses and the
+ * number of Course ids as arguments, allocates heap space
+ * for a PrereqExpr with its clause ends and ids in the
+ * same block, and returns a pointer to it
+ */
+PrereqExpr* initPrereqExpr(unsigned int numClauses, unsigned int numTerms) {
+
+	// allocating heap space
+	PrereqExpr *exprPtr = (PrereqExpr*) malloc( sizeof(PrereqExpr) + (numClauses + numTerms) * sizeof(unsigned int) );
+	// filling in data members
+	exprPtr->numClauses = numClauses;
+	exprPtr->numTerms = numTerms;
+	return exprPtr;
+}
+
+/*
+ * freePrereqExpr() takes a PrereqExpr pointer as an
+ * argument and frees it
+ */
+void freePrereqExpr(PrereqExpr *exprPtr) {
+
+	free(exprPtr);
+	return;
+}
+
+/*
+ * prereqClauseEnds() returns a pointer to the first
+ * clause end of the PrereqExpr
+ */
+unsigned int* prereqClauseEnds(PrereqExpr *exprPtr) {
+
+	return exprPtr->terms;
+}
+
+/*
+ * prereqCourseIds() returns a pointer to the first
+ * Course id of the PrereqExpr, right after its
+ * clause ends
+ */
+unsigned int* prereqCourseIds(PrereqExpr *exprPtr) {
+
+	return exprPtr->terms + exprPtr->numClauses;
+}
+
+/*
+ * evaluatePrereqExpr() takes a PrereqExpr pointer and a
+ * BitSet pointer of completed Course ids as arguments
+ *
+ * evaluatePrereqExpr() ORs the completed bits of every
+ * Course id of a clause together and ANDs the clauses -
+ * there is no early exit and no branch inside a clause,
+ * and an id past the end of the BitSet reads word zero
+ * and is masked off instead of being tested for
+ *
+ * returns true if the prerequisites are fulfilled
+ */
+bool evaluatePrereqExpr(PrereqExpr *exprPtr, BitSet *completedPtr) {
+
+	// no prerequisites
+	if (exprPtr == NULL) {
+		return true;
+	}
+	if (completedPtr == NULL) {
+		return false;
+	}
+
+	const uint64_t *words = completedPtr->words;
+	const unsigned int numWords = completedPtr->numWords;
+	const unsigned int *clauseEnds = prereqClauseEnds(exprPtr);
+	const unsigned int *courseIds = prereqCourseIds(exprPtr);
+	uint64_t allClauses = 1;
+	unsigned int term = 0;
+	for (unsigned int i = 0; i < exprPtr->numClauses; i++) {
+		uint64_t anyTerm = 0;
+		for (; term < clauseEnds[i]; term++) {
+			unsigned int courseId = courseIds[term];
+			unsigned int word = courseId / 64;
+			uint64_t inRange = (word < numWords);
+			anyTerm |= (words[inRange ? word : 0] >> (courseId % 64)) & inRange;
+		}
+		allClauses &= anyTerm;
+	}
+	return allClauses != 0;
+}
+
+/*
+ * prereqClauseContains() takes a PrereqExpr pointer, the
+ * index of a clause, and a Course id as arguments and
+ * returns true if the id is one of the clause's ids
+ */
+bool prereqClauseContains(PrereqExpr *exprPtr, unsigned int clauseIndex, unsigned int courseId) {
+
+	if (exprPtr == NULL || clauseIndex >= exprPtr->numClauses) {
+		return false;
+	}
+
+	unsigned int *clauseEnds = prereqClauseEnds(exprPtr);
+	unsigned int *courseIds = prereqCourseIds(exprPtr);
+	unsigned int term = (clauseIndex == 0) ? 0 : clauseEnds[clauseIndex - 1];
+	for (; term < clauseEnds[clauseIndex]; term++) {
+		if (courseIds[term] == courseId) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/*
+ * prereqExprContains() takes a PrereqExpr pointer and a
+ * Course id as arguments and returns true if the id is
+ * in any clause
+ */
+bool prereqExprContains(PrereqExpr *exprPtr, unsigned int courseId) {
+
+	if (exprPtr == NULL) {
+		return false;
+	}
+
+	unsigned int *courseIds = prereqCourseIds(exprPtr);
+	for (unsigned int i = 0; i < exprPtr->numTerms; i++) {
+		if (courseIds[i] == courseId) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/*
+ * isPrereqGroup() returns true if the prerequisite
+ * string starts with an opening parenthesis
+ */
+bool isPrereqGroup(char *prereqString) {
+
+	return prereqString != NULL && prereqString[0] == '(';
+}
+
+/*
+ * findPrereqGroupName() takes a group string, the index
+ * of a name, and pointers to the start and length of
+ * the name as arguments
+ *
+ * findPrereqGroupName() steps over the group's names,
+ * separated by PREREQ_GROUP_OR, up to the closing
+ * parenthesis (or the end of the string), and fills in
+ * where the indexed name starts and how long it is,
+ * without surrounding spaces
+ *
+ * returns false if the group has no such name
+ */
+bool findPrereqGroupName(char *groupString, int nameIndex, char **startPtr, int *lengthPtr) {
+
+	char *namePtr = groupString + 1;
+	char *groupEnd = strchr(namePtr, ')');
+	if (groupEnd == NULL) {
+		groupEnd = namePtr + strlen(namePtr);
+	}
+	int separatorLength = strlen(PREREQ_GROUP_OR);
+
+	for (int i = 0; namePtr < groupEnd; i++) {
+		// finding where the name ends
+		char *nameEnd = strstr(namePtr, PREREQ_GROUP_OR);
+		if (nameEnd == NULL || nameEnd > groupEnd) {
+			nameEnd = groupEnd;
+		}
+		if (i == nameIndex) {
+			// trimming spaces around the name
+			while (namePtr < nameEnd && *namePtr == ' ') {
+				namePtr++;
+			}
+			while (nameEnd > namePtr && *(nameEnd - 1) == ' ') {
+				nameEnd--;
+			}
+			*startPtr = namePtr;
+			*lengthPtr = nameEnd - namePtr;
+			return true;
+		}
+		namePtr = nameEnd + separatorLength;
+	}
+	return false;
+}
+
+/*
+ * countPrereqGroupNames() takes a group string as an
+ * argument and returns the number of Course names
+ * in it
+ */
+int countPrereqGroupNames(char *groupString) {
+
+	if ( !isPrereqGroup(groupString) ) {
+		return 0;
+	}
+
+	char *namePtr = NULL;
+	int nameLength = 0;
+	int numNames = 0;
+	while ( findPrereqGroupName(groupString, numNames, &namePtr, &nameLength) ) {
+		numNames++;
+	}
+	return numNames;
+}
+
+/*
+ * copyPrereqGroupName() takes a group string and the
+ * index of a name as arguments and returns a new heap
+ * copy of the name, or NULL if there is no such name
+ */
+char* copyPrereqGroupName(char *groupString, int nameIndex) {
+
+	if ( !isPrereqGroup(groupString) ) {
+		return NULL;
+	}
+
+	char *namePtr = NULL;
+	int nameLength = 0;
+	if ( !findPrereqGroupName(groupString, nameIndex, &namePtr, &nameLength) ) {
+		return NULL;
+	}
+	return strndup(namePtr, nameLength);
+}
+
+/*
+ * prereqStringHasCourse() takes a prerequisite string and
+ * a Course name as arguments and returns true if the
+ * string is the Course name, or is a group with the
+ * Course name as one of its names
+ */
+bool prereqStringHasCourse(char *prereqString, char *courseName) {
+
+	if (prereqString == NULL || courseName == NULL) {
+		return false;
+	}
+	if ( !isPrereqGroup(prereqString) ) {
+		return strcmp(prereqString, courseName) == 0;
+	}
+
+	char *namePtr = NULL;
+	int nameLength = 0;
+	int courseNameLength = strlen(courseName);
+	for (int i = 0; findPrereqGroupName(prereqString, i, &namePtr, &nameLength); i++) {
+		if ( nameLength == courseNameLength && strncmp(namePtr, courseName, nameLength) == 0 ) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/*
+ * removeFromPrereqGroup() takes a group string and a
+ * Course name as arguments
+ *
+ * removeFromPrereqGroup() builds a new heap string of
+ * the group's other names joined by PREREQ_GROUP_OR in
+ * parentheses, or just the remaining name if only one
+ * is left
+ *
+ * returns NULL if no name is left
+ */
+char* removeFromPrereqGroup(char *groupString, char *courseName) {
+
+	int groupLength = strlen(groupString);
+	char *newGroup = (char*) calloc(groupLength + 3, sizeof(char));
+	char *namePtr = NULL;
+	int nameLength = 0;
+	int courseNameLength = strlen(courseName);
+	int numKept = 0;
+	strcat(newGroup, "(");
+	for (int i = 0; findPrereqGroupName(groupString, i, &namePtr, &nameLength); i++) {
+		if ( nameLength == courseNameLength && strncmp(namePtr, courseName, nameLength) == 0 ) {
+			continue;
+		}
+		if (numKept > 0) {
+			strcat(newGroup, PREREQ_GROUP_OR);
+		}
+		strncat(newGroup, namePtr, nameLength);
+		numKept++;
+	}
+	if (numKept == 0) {
+		free(newGroup);
+		return NULL;
+	}
+	if (numKept == 1) {
+		// a group of one is just the Course name
+		memmove(newGroup, newGroup + 1, strlen(newGroup));
+		return newGroup;
+	}
+	strcat(newGroup, ")");
+	return newGroup;
+}
@@ -0,0 +1,186 @@
+/*
+ *
+ *	Header file for the PrereqExpr ADT interface
+ *
+ *	A PrereqExpr is a Course's prerequisites compiled
+ *	into an AND of OR clauses of Course ids, so they can
+ *	be checked against a BitSet of completed Course ids
+ *	without following the prerequisite string list or
+ *	comparing Course names.
+ *
+ *	The prerequisite line of a Department file is split
+ *	at commas into a list of strings (see course.h):
+ *		A, B, C - every Course is required, one
+ *		clause per Course
+ *		OR A, B, C - any one Course is enough, a
+ *		single clause with every Course
+ *		(A OR B), C - a group in parentheses is
+ *		fulfilled by any one of its Courses and
+ *		becomes one clause of its own, so mixed
+ *		forms such as "(A OR B) and C" can be
+ *		written
+ *	The clauses of a PrereqExpr are in the order of the
+ *	strings they were compiled from, so clause i of an
+ *	expression without the leading OR is the i-th
+ *	string of the list.
+ *
+ *	The whole expression is one allocation: the end of
+ *	each clause in the id array, followed by the ids.
+ *	evaluatePrereqExpr() allocates nothing and has no
+ *	branches inside a clause. A Course with no
+ *	prerequisites has no PrereqExpr (NULL), which is
+ *	always fulfilled.
+ *
+ */
+
+#ifndef PREREQEXPR_H
+#define PREREQEXPR_H
+
+#include <stdbool.h>
+#include "bitSet.h"
+
+// string that marks a prerequisite list as one disjunct
+// clause, and the separator of Courses inside a group
+#define PREREQ_OR "OR"
+#define PREREQ_GROUP_OR " OR "
+
+// struct for a compiled prerequisite expression
+//
+// terms holds numClauses clause ends, then numTerms
+// Course ids - clause i is ids[clauseEnds[i-1]] up to
+// (not including) ids[clauseEnds[i]]
+typedef struct prereqExpr {
+	unsigned int numClauses;
+	unsigned int numTerms;
+	unsigned int terms[];
+} PrereqExpr;
+
+
+// PrereqExpr interface
+
+/*
+ * allocates heap space for a PrereqExpr with
+ * room for the given number of clauses and
+ * Course ids and returns a pointer to it -
+ * the clause ends and ids are filled in by
+ * the caller
+ *
+ * numClauses - number of OR clauses
+ *
+ * numTerms - total number of Course ids in
+ * all of the clauses
+ */
+PrereqExpr* initPrereqExpr(unsigned int numClauses, unsigned int numTerms);
+
+/*
+ * frees a PrereqExpr
+ *
+ * exprPtr - pointer to the PrereqExpr to free
+ */
+void freePrereqExpr(PrereqExpr* exprPtr);
+
+/*
+ * returns a pointer to the clause ends of a
+ * PrereqExpr
+ *
+ * exprPtr - pointer to the PrereqExpr
+ */
+unsigned int* prereqClauseEnds(PrereqExpr* exprPtr);
+
+/*
+ * returns a pointer to the Course ids of a
+ * PrereqExpr
+ *
+ * exprPtr - pointer to the PrereqExpr
+ */
+unsigned int* prereqCourseIds(PrereqExpr* exprPtr);
+
+/*
+ * returns true if every clause of the
+ * PrereqExpr has a Course id set in the
+ * BitSet of completed Course ids - a NULL
+ * PrereqExpr (no prerequisites) is always
+ * fulfilled
+ *
+ * exprPtr - pointer to the PrereqExpr
+ *
+ * completedPtr - pointer to the BitSet of
+ * completed Course ids
+ */
+bool evaluatePrereqExpr(PrereqExpr* exprPtr, BitSet* completedPtr);
+
+/*
+ * returns true if the given clause of the
+ * PrereqExpr has the Course id
+ *
+ * exprPtr - pointer to the PrereqExpr
+ *
+ * clauseIndex - index of the clause to check
+ *
+ * courseId - id of the Course to look for
+ */
+bool prereqClauseContains(PrereqExpr* exprPtr, unsigned int clauseIndex, unsigned int courseId);
+
+/*
+ * returns true if any clause of the
+ * PrereqExpr has the Course id
+ *
+ * exprPtr - pointer to the PrereqExpr
+ *
+ * courseId - id of the Course to look for
+ */
+bool prereqExprContains(PrereqExpr* exprPtr, unsigned int courseId);
+
+/*
+ * returns true if the prerequisite string
+ * is a group of Courses in parentheses
+ *
+ * prereqString - one string of a Course's
+ * prerequisite list
+ */
+bool isPrereqGroup(char* prereqString);
+
+/*
+ * returns the number of Course names in a
+ * prerequisite group
+ *
+ * groupString - the group, in parentheses
+ */
+int countPrereqGroupNames(char* groupString);
+
+/*
+ * returns a new heap copy of one Course
+ * name of a prerequisite group, without
+ * the parentheses and separators
+ *
+ * groupString - the group, in parentheses
+ *
+ * nameIndex - index of the name in the group
+ */
+char* copyPrereqGroupName(char* groupString, int nameIndex);
+
+/*
+ * returns true if a prerequisite string is
+ * the given Course name or a group that
+ * has the given Course name
+ *
+ * prereqString - one string of a Course's
+ * prerequisite list
+ *
+ * courseName - name of the Course to look for
+ */
+bool prereqStringHasCourse(char* prereqString, char* courseName);
+
+/*
+ * returns a new heap string for a group
+ * with the given Course name left out - a
+ * plain Course name if only one is left,
+ * or NULL if none is left
+ *
+ * groupString - the group, in parentheses
+ *
+ * courseName - name of the Course to leave out
+ */
+char* removeFromPrereqGroup(char* groupString, char* courseName);
+
+#endif
@@ -0,0 +1,342 @@
+/*
+ *
+ *	C source file containing the implementation of
+ *	the PrereqGraph ADT
+ *
+ *	Go to header file for more information
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "prereqGraph.h"
+
+// index of a Course not yet reached by Tarjan's algorithm
+#define UNVISITED UINT_MAX
+
+/*
+ * buildPrereqEdges() takes a CourseBinaryTree pointer and a
+ * PrereqGraph pointer as arguments
+ *
+ * buildPrereqEdges() counts the prerequisites of every
+ * Course on the tree, turns the counts into edge starts,
+ * and copies the Course ids into a single edge array -
+ * prerequisites no longer on the tree are left out
+ *
+ * the same edges are then turned around into the
+ * dependents of every Course
+ */
+void buildPrereqEdges(CourseBinaryTree *bt, PrereqGraph *graphPtr) {
+
+	unsigned int numNodes = graphPtr->numNodes;
+	graphPtr->edgeStarts = (unsigned int*) calloc(numNodes + 1, sizeof(unsigned int));
+	for (unsigned int id = 0; id < numNodes; id++) {
+		Course *coursePtr = bt->coursesById[id];
+		unsigned int numEdges = 0;
+		if (coursePtr != NULL && coursePtr->prereqExpr != NULL) {
+			unsigned int *courseIds = prereqCourseIds(coursePtr->prereqExpr);
+			for (unsigned int i = 0; i < coursePtr->prereqExpr->numTerms; i++) {
+				numEdges += (findCourseById(bt, courseIds[i]) != NULL);
+			}
+		}
+		graphPtr->edgeStarts[id + 1] = graphPtr->edgeStarts[id] + numEdges;
+	}
+
+	graphPtr->edges = (unsigned int*) malloc( (graphPtr->edgeStarts[numNodes] + 1) * sizeof(unsigned int) );
+	for (unsigned int id = 0; id < numNodes; id++) {
+		Course *coursePtr = bt->coursesById[id];
+		if (coursePtr == NULL || coursePtr->prereqExpr == NULL) {
+			continue;
+		}
+		unsigned int edge = graphPtr->edgeStarts[id];
+		unsigned int *courseIds = prereqCourseIds(coursePtr->prereqExpr);
+		for (unsigned int i = 0; i < coursePtr->prereqExpr->numTerms; i++) {
+			if (findCourseById(bt, courseIds[i]) != NULL) {
+				graphPtr->edges[edge] = courseIds[i];
+				edge++;
+			}
+		}
+	}
+
+	// turning the edges around - filling by Course id keeps
+	// each Course's dependents in id order
+	unsigned int numEdges = graphPtr->edgeStarts[numNodes];
+	graphPtr->dependentStarts = (unsigned int*) calloc(numNodes + 2, sizeof(unsigned int));
+	for (unsigned int edge = 0; edge < numEdges; edge++) {
+		graphPtr->dependentStarts[ graphPtr->edges[edge] + 2 ]++;
+	}
+	for (unsigned int id = 2; id < numNodes + 2; id++) {
+		graphPtr->dependentStarts[id] += graphPtr->dependentStarts[id - 1];
+	}
+	graphPtr->dependents = (unsigned int*) malloc( (numEdges + 1) * sizeof(unsigned int) );
+	for (unsigned int id = 0; id < numNodes; id++) {
+		for (unsigned int edge = graphPtr->edgeStarts[id]; edge < graphPtr->edgeStarts[id + 1]; edge++) {
+			graphPtr->dependents[ graphPtr->dependentStarts[ graphPtr->edges[edge] + 1 ]++ ] = id;
+		}
+	}
+	return;
+}
+
+/*
+ * findPrereqComponents() takes a CourseBinaryTree pointer
+ * and a PrereqGraph pointer with its edges built as
+ * arguments
+ *
+ * findPrereqComponents() runs Tarjan's algorithm with an
+ * explicit stack of (Course id, next edge) frames in place
+ * of recursion, so a long chain of prerequisites cannot
+ * overflow the call stack
+ *
+ * a component is complete only after every component it
+ * has an edge to, so the components come out with every
+ * Course's prerequisites first - they are appended to
+ * topoOrder in that order
+ */
+void findPrereqComponents(CourseBinaryTree *bt, PrereqGraph *graphPtr) {
+
+	unsigned int numNodes = graphPtr->numNodes;
+	unsigned int *edgeStarts = graphPtr->edgeStarts;
+	unsigned int *edges = graphPtr->edges;
+
+	graphPtr->topoOrder = (unsigned int*) malloc( (numNodes + 1) * sizeof(unsigned int) );
+	graphPtr->componentStarts = (unsigned int*) malloc( (numNodes + 1) * sizeof(unsigned int) );
+	graphPtr->componentOf = (unsigned int*) malloc( (numNodes + 1) * sizeof(unsigned int) );
+	graphPtr->componentStarts[0] = 0;
+
+	// working arrays of the search
+	unsigned int *index = (unsigned int*) malloc( (numNodes + 1) * sizeof(unsigned int) );
+	unsigned int *lowLink = (unsigned int*) malloc( (numNodes + 1) * sizeof(unsigned int) );
+	bool *onStack = (bool*) calloc(numNodes + 1, sizeof(bool));
+	unsigned int *componentStack = (unsigned int*) malloc( (numNodes + 1) * sizeof(unsigned int) );
+	unsigned int *frameIds = (unsigned int*) malloc( (numNodes + 1) * sizeof(unsigned int) );
+	unsigned int *frameEdges = (unsigned int*) malloc( (numNodes + 1) * sizeof(unsigned int) );
+	unsigned int componentTop = 0;
+	unsigned int nextIndex = 0;
+	for (unsigned int id = 0; id < numNodes; id++) {
+		index[id] = UNVISITED;
+		graphPtr->componentOf[id] = UNVISITED;
+	}
+
+	for (unsigned int root = 0; root < numNodes; root++) {
+		if (index[root] != UNVISITED || bt->coursesById[root] == NULL) {
+			continue;
+		}
+
+		// entering the root
+		unsigned int frameTop = 0;
+		frameIds[frameTop] = root;
+		frameEdges[frameTop] = edgeStarts[root];
+		frameTop++;
+		index[root] = lowLink[root] = nextIndex++;
+		componentStack[componentTop++] = root;
+		onStack[root] = true;
+
+		while (frameTop > 0) {
+			unsigned int id = frameIds[frameTop - 1];
+			if (frameEdges[frameTop - 1] < edgeStarts[id + 1]) {
+				unsigned int prereqId = edges[ frameEdges[frameTop - 1]++ ];
+				if (index[prereqId] == UNVISITED) {
+					// entering the prerequisite
+					frameIds[frameTop] = prereqId;
+					frameEdges[frameTop] = edgeStarts[prereqId];
+					frameTop++;
+					index[prereqId] = lowLink[prereqId] = nextIndex++;
+					componentStack[componentTop++] = prereqId;
+					onStack[prereqId] = true;
+				} else if (onStack[prereqId] && index[prereqId] < lowLink[id]) {
+					lowLink[id] = index[prereqId];
+				}
+				continue;
+			}
+
+			// every edge of the Course is done - it is the
+			// first Course of its component if nothing on the
+			// stack below it can reach back before it
+			if (lowLink[id] == index[id]) {
+				unsigned int memberId;
+				do {
+					memberId = componentStack[--componentTop];
+					onStack[memberId] = false;
+					graphPtr->componentOf[memberId] = graphPtr->numComponents;
+					graphPtr->topoOrder[graphPtr->numOrdered++] = memberId;
+				} while (memberId != id);
+				graphPtr->numComponents++;
+				graphPtr->componentStarts[graphPtr->numComponents] = graphPtr->numOrdered;
+			}
+			frameTop--;
+			if (frameTop > 0) {
+				unsigned int parentId = frameIds[frameTop - 1];
+				if (lowLink[id] < lowLink[parentId]) {
+					lowLink[parentId] = lowLink[id];
+				}
+			}
+		}
+	}
+
+	for (unsigned int c = 0; c < graphPtr->numComponents; c++) {
+		graphPtr->numCycles += isPrereqCycle(graphPtr, c);
+	}
+
+	free(index);
+	free(lowLink);
+	free(onStack);
+	free(componentStack);
+	free(frameIds);
+	free(frameEdges);
+	return;
+}
+
+/*
+ * buildPrereqGraph() takes a CourseBinaryTree pointer as an
+ * argument, allocates heap space for a PrereqGraph, builds
+ * its edges and components, and returns a pointer to it
+ *
+ * returns NULL for error
+ */
+PrereqGraph* buildPrereqGraph(CourseBinaryTree *bt) {
+
+	// checking for NULL pointer argument
+	if (bt == NULL) {
+		printf("\nCannot build a prerequisite graph "
+				"with NULL CourseBinaryTree "
+				"pointer argument\n");
+		return NULL;
+	}
+
+	// allocating heap space
+	PrereqGraph *graphPtr = (PrereqGraph*) malloc(sizeof(PrereqGraph));
+	// filling in data members
+	graphPtr->treeVersion = bt->version;
+	graphPtr->numNodes = bt->numCourseIds;
+	graphPtr->numOrdered = 0;
+	graphPtr->numComponents = 0;
+	graphPtr->numCycles = 0;
+	buildPrereqEdges(bt, graphPtr);
+	findPrereqComponents(bt, graphPtr);
+	return graphPtr;
+}
+
+/*
+ * freePrereqGraph() takes a PrereqGraph pointer as an
+ * argument and frees its arrays and the PrereqGraph
+ */
+void freePrereqGraph(PrereqGraph *graphPtr) {
+
+	if (graphPtr == NULL) {
+		return;
+	}
+	free(graphPtr->edgeStarts);
+	free(graphPtr->edges);
+	free(graphPtr->dependentStarts);
+	free(graphPtr->dependents);
+	free(graphPtr->topoOrder);
+	free(graphPtr->componentStarts);
+	free(graphPtr->componentOf);
+	free(graphPtr);
+	return;
+}
+
+/*
+ * getPrereqGraph() takes a CourseBinaryTree pointer as an
+ * argument
+ *
+ * if the version of the tree matches the version the
+ * tree's PrereqGraph was built from, getPrereqGraph()
+ * returns it as is - otherwise the old graph is freed
+ * and a new one is built and kept on the tree
+ *
+ * returns NULL for error
+ */
+PrereqGraph* getPrereqGraph(CourseBinaryTree *bt) {
+
+	// checking for NULL pointer argument
+	if (bt == NULL) {
+		printf("\nCannot get the prerequisite graph "
+				"with NULL CourseBinaryTree "
+				"pointer argument\n");
+		return NULL;
+	}
+
+	if (bt->prereqGraph == NULL || bt->prereqGraph->treeVersion != bt->version) {
+		freePrereqGraph(bt->prereqGraph);
+		bt->prereqGraph = buildPrereqGraph(bt);
+	}
+	return bt->prereqGraph;
+}
+
+/*
+ * isPrereqCycle() takes a PrereqGraph pointer and the index
+ * of a component as arguments and returns true if the
+ * component has more than one Course, or one Course with
+ * an edge to itself
+ */
+bool isPrereqCycle(PrereqGraph *graphPtr, unsigned int component) {
+
+	if (graphPtr == NULL || component >= graphPtr->numComponents) {
+		return false;
+	}
+
+	unsigned int first = graphPtr->componentStarts[component];
+	unsigned int last = graphPtr->componentStarts[component + 1];
+	if (last - first > 1) {
+		return true;
+	}
+	unsigned int id = graphPtr->topoOrder[first];
+	for (unsigned int edge = graphPtr->edgeStarts[id]; edge < graphPtr->edgeStarts[id + 1]; edge++) {
+		if (graphPtr->edges[edge] == id) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/*
+ * printPrereqGraphProblems() takes a CourseBinaryTree
+ * pointer as an argument
+ *
+ * printPrereqGraphProblems() prints the Courses of every
+ * prerequisite cycle, and every prerequisite that has no
+ * Department along with the Course that requires it
+ *
+ * returns the number of cycles and missing prerequisites
+ * printed
+ */
+int printPrereqGraphProblems(CourseBinaryTree *bt) {
+
+	PrereqGraph *graphPtr = getPrereqGraph(bt);
+	if (graphPtr == NULL) {
+		return 0;
+	}
+
+	int numProblems = 0;
+	for (unsigned int c = 0; c < graphPtr->numComponents; c++) {
+		if ( !isPrereqCycle(graphPtr, c) ) {
+			continue;
+		}
+		printf("\nPrerequisite cycle: ");
+		for (unsigned int i = graphPtr->componentStarts[c]; i < graphPtr->componentStarts[c + 1]; i++) {
+			if (i > graphPtr->componentStarts[c]) {
+				printf(", ");
+			}
+			printf("%s", bt->coursesById[ graphPtr->topoOrder[i] ]->name);
+		}
+		printf("\n");
+		numProblems++;
+	}
+
+	for (unsigned int id = 0; id < graphPtr->numNodes; id++) {
+		for (unsigned int edge = graphPtr->edgeStarts[id]; edge < graphPtr->edgeStarts[id + 1]; edge++) {
+			Course *prereqPtr = bt->coursesById[ graphPtr->edges[edge] ];
+			if (prereqPtr->depName == NULL) {
+				printf("\nPrerequisite %s of %s is not in "
+						"any Department\n",
+						prereqPtr->name,
+						bt->coursesById[id]->name);
+				numProblems++;
+			}
+		}
+	}
+	return numProblems;
+}
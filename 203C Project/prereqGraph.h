@@ -0,0 +1,112 @@
+/*
+ *
+ *	Header file for the PrereqGraph ADT interface
+ *
+ *	A PrereqGraph is the prerequisite graph of every
+ *	Course on the CourseBinaryTree, indexed by Course id,
+ *	with an edge from each Course to every Course of its
+ *	compiled prerequisites (see prereqExpr.h). Both
+ *	sides of a disjunct prerequisite are edges.
+ *
+ *	The edges are stored compressed: the prerequisites
+ *	of Course id are edges[edgeStarts[id]] up to (not
+ *	including) edges[edgeStarts[id + 1]], so the whole
+ *	graph is two arrays and is walked without following
+ *	any list. The Courses that require Course id are
+ *	stored the same way in dependents, in id order, once
+ *	for every time the Course appears in their
+ *	prerequisites.
+ *
+ *	The graph is split into strongly connected components
+ *	with Tarjan's algorithm, without recursion. A
+ *	component of more than one Course, or of one Course
+ *	that requires itself, is a prerequisite cycle.
+ *
+ *	topoOrder lists every Course on the tree, component
+ *	by component, so that every Course comes after the
+ *	Courses it requires (the members of a cycle are next
+ *	to each other). Analyses that need a Course's
+ *	prerequisites finished first can walk topoOrder
+ *	instead of recursing.
+ *
+ *	Building the graph takes linear time in the number of
+ *	Courses and prerequisites. The graph is kept on the
+ *	CourseBinaryTree and built again by getPrereqGraph()
+ *	only when the tree's version has changed.
+ *
+ */
+
+#ifndef PREREQGRAPH_H
+#define PREREQGRAPH_H
+
+#include "courseBT.h"
+
+// struct for the prerequisite graph of a CourseBinaryTree
+//
+// component c is topoOrder[componentStarts[c]] up to (not
+// including) topoOrder[componentStarts[c + 1]] - ids of
+// Courses no longer on the tree have no edges and are
+// in no component
+typedef struct prereqGraph {
+	unsigned int treeVersion;
+	unsigned int numNodes;
+	unsigned int *edgeStarts;
+	unsigned int *edges;
+	unsigned int *dependentStarts;
+	unsigned int *dependents;
+	unsigned int numOrdered;
+	unsigned int *topoOrder;
+	unsigned int numComponents;
+	unsigned int *componentStarts;
+	unsigned int *componentOf;
+	unsigned int numCycles;
+} PrereqGraph;
+
+
+// PrereqGraph interface
+
+/*
+ * builds the PrereqGraph of every Course on
+ * the CourseBinaryTree and returns a pointer
+ * to it
+ *
+ * bt - pointer to the CourseBinaryTree
+ */
+PrereqGraph* buildPrereqGraph(CourseBinaryTree* bt);
+
+/*
+ * frees a PrereqGraph and its arrays
+ *
+ * graphPtr - pointer to the PrereqGraph to free
+ */
+void freePrereqGraph(PrereqGraph* graphPtr);
+
+/*
+ * returns the CourseBinaryTree's PrereqGraph,
+ * building it again first if the tree has
+ * changed since it was last built
+ *
+ * bt - pointer to the CourseBinaryTree
+ */
+PrereqGraph* getPrereqGraph(CourseBinaryTree* bt);
+
+/*
+ * returns true if the component is a
+ * prerequisite cycle
+ *
+ * graphPtr - pointer to the PrereqGraph
+ *
+ * component - index of the component
+ */
+bool isPrereqCycle(PrereqGraph* graphPtr, unsigned int component);
+
+/*
+ * prints every prerequisite cycle and every
+ * prerequisite that belongs to no Department,
+ * and returns the number of problems printed
+ *
+ * bt - pointer to the CourseBinaryTree to check
+ */
+int printPrereqGraphProblems(CourseBinaryTree* bt);
+
+#endif
@@ -11,25 +11,57 @@
  *	a - addCourseToDepartment()
  *	m - studentCoursesStillNeeded()
  *	n - showAvailableCoursesForStudent()
- *	r - removeCourseFromAll()
+ *	r - removeCoursesFromAll()
  *	p - handleCmdP() (found in userInterface)
  *		c - findAndPrintCourse2()
  *		d - findAndPrintDepartment()
  *		g - findAndPrintDegree()
  *		s - findAndPrintStudent()
  *	q - removeCourseFromDegree()
+ *	t - handleCmdT() (found in userInterface)
+ *		a - tallyAllCourseCompletions()
+ *		c - tallyCourseCompletions()
+ *		d - tallyCourseCompletionsByDegree()
+ *		b - tallyJointCourseCompletions()
+ *	e - printPrerequisiteChain()
+ *	g - planStudentGraduation()
+ *	w - showWhatIfCompleted()
+ *	v - tallyAvailableCourses()
+ *	b - auditAllStudents()
+ *	k - rankStudentsByGraduation()
+ *	j - compareStudentAcrossDegrees()
+ *	i - printAuditCacheStats() (found in auditCache)
  *	x - exit
  *
+ *	built with COMMAND_TIMING defined (make timing
+ *	builds it as main-timing), the
+ *	'v' command also measures how fast the
+ *	AvailabilityMatrix is evaluated, and the 'b', 'k',
+ *	and 'j' commands print how long they took on a line
+ *	of their own - normal builds leave every command's
+ *	output the same from run to run
+ *
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#ifdef COMMAND_TIMING
+#include <time.h>
+#endif
 
 #include "courseBT.h"
 #include "departmentVector.h"
 #include "degreeVector.h"
 #include "studentBT.h"
+#include "completionStore.h"
+#include "courseSet.h"
+#include "prereqClosure.h"
+#include "graduationPlan.h"
+#include "availabilityMatrix.h"
+#include "degreeAudit.h"
+#include "auditCache.h"
+#include "stringPool.h"
 #include "programCommand.h"
 
 /*
@@ -320,7 +352,7 @@ void effectOfCompletedCourse(CourseBinaryTree *courseTreePtr, char *queryCourseN
  *
  * addCourseToDepartment() finds/inserts a Course into the
  * CourseBinaryTree, updates the Course's title, prerequisite
- * Courses, and Department name
+ * Courses (compiling them again), and Department name
  *
  * addCourseToDepartment() searches the DepartmetVector for
  * a Department with the specified Department name
@@ -395,6 +427,12 @@ void addCourseToDepartment(CourseBinaryTree *courseTreePtr, DepartmentVector *de
 	}
 
 
+	// the Department name and Course title are kept by the
+	// Course, so they are pooled rather than left in the
+	// user's input (the Course name is pooled by the tree)
+	departmentName = internString(departmentName);
+	courseTitle = internString(courseTitle);
+
 	// finding/creating Course pointer and CourseBTNode with name courseName
 	Course* coursePtr = insertInCourseBinaryTree(courseTreePtr, courseName);
 	// filling Course data members
@@ -422,6 +460,13 @@ void addCourseToDepartment(CourseBinaryTree *courseTreePtr, DepartmentVector *de
 		}
 
 	}
+	// compiling the new prerequisites, if any
+	compileCoursePrerequisites(courseTreePtr, coursePtr);
+	// updating the closures that depended on the old prerequisites
+	BitSet *changedIds = initBitSet(courseTreePtr->numCourseIds);
+	setBit(changedIds, coursePtr->id);
+	updatePrereqClosures(courseTreePtr, changedIds);
+	freeBitSet(changedIds);
 
 	coursePtr->depName = departmentName;
 	Department* depPtr = findInDepartmentVector(depListPtr, departmentName);
@@ -449,17 +494,21 @@ void addCourseToDepartment(CourseBinaryTree *courseTreePtr, DepartmentVector *de
  * studentCoursesStillNeeded() searches the StudentBinaryTree with 
  * the given Student name, queryStudentName, for a Student pointer
  *
- * if the Student is found, then the Student's Degree name is used
- * to search the DegreeVector for a pointer to his or her Degree
+ * if the Student is found, then the Student's resolved Degree 
+ * pointer is used (getStudentDegree() only searches the 
+ * DegreeVector when it has changed)
  *
- * with access to the Student's completed Courses and the Degree's
- * required Courses, printDifferingCourses() is used to print all
+ * with the Student's completed Course ids and the Degree's
+ * requirement groups, requirementDifference() builds a Vector of all
  * of the Courses the Degree program contains that the Student has
- * not yet completed - the Courses the Student still needs to complete
+ * not yet completed, which is printed with printVector() - the Courses the Student still needs to complete
  * for his or her Degree program
  *
+ * the Vector is kept in the AuditCache, and printed from there
+ * while nothing it depends on has changed
+ *
  */
-void studentCoursesStillNeeded(DegreeVector *degListPtr, StudentBinaryTree *studentTreePtr, char *queryStudentName) {
+void studentCoursesStillNeeded(CourseBinaryTree *courseTreePtr, DegreeVector *degListPtr, StudentBinaryTree *studentTreePtr, AuditCache *auditCachePtr, char *queryStudentName) {
 
 	// checking for NULL pointer arguments
 	if (queryStudentName == NULL) {
@@ -499,37 +548,49 @@ void studentCoursesStillNeeded(DegreeVector *degListPtr, StudentBinaryTree *stud
 				queryStudentName);
 		return;
 	}
-	// Student found - searching for Student's Degree
+	// Student found - getting the Student's resolved Degree
 	char *studentDegreeName = givenStudentNodePtr->studentPtr->degree;	
-	Degree* studentDegreePtr = findInDegreeVector(degListPtr, studentDegreeName);
+	Degree* studentDegreePtr = getStudentDegree(givenStudentNodePtr->studentPtr, degListPtr);
 
 	if (studentDegreePtr == NULL) {
 		printf("\nSTUDENT DEGREE %s NOT FOUND IN DEG LIST\n", studentDegreeName);
 		return;
 	}
 
-	Vector *degreeCourses = studentDegreePtr->reqCourses;
-	Vector *stuCompletedCourses = givenStudentNodePtr->studentPtr->completedCourses;
-	// loop through all of the Degree courses and check if they are in the Student's
-	// printing all Courses in the Degree program and not in the Student's completed
-	// Course list
-	int numCoursesNeeded = printDifferingCourses(degreeCourses, stuCompletedCourses);
-	if (numCoursesNeeded == 0) {
+	Student *studentPtr = givenStudentNodePtr->studentPtr;
+	Vector *coursesNeeded = findAuditResult(auditCachePtr, studentPtr, AUDIT_STILL_NEEDED, studentDegreePtr, courseTreePtr);
+	bool cached = (coursesNeeded != NULL);
+	if (!cached) {
+		RequirementGroups *degreeGroups = getDegreeRequirementGroups(studentDegreePtr);
+		BitSet *stuCompletedSet = getStudentCompletedSet(studentPtr);
+		// auditing every requirement group of the Degree against the Student's
+		// completed Course ids for all Courses in the Degree program 
+		// that are not fulfilled
+		coursesNeeded = requirementDifference(degreeGroups, stuCompletedSet);
+		cached = storeAuditResult(auditCachePtr, studentPtr, AUDIT_STILL_NEEDED, studentDegreePtr, courseTreePtr, coursesNeeded);
+	}
+	if (coursesNeeded->numElements == 0) {
 		printf("\n%s has all Degree requirements fulfilled\n", queryStudentName);
+	} else {
+		printVector(coursesNeeded);
+	}
+	if (!cached) {
+		freeVector(coursesNeeded);
 	}
 
 	return;
 }
 
 /*
- * showAvailableCoursesForStudent() takes a DegreeVector pointer,
- * StudentBinaryTree pointer, and Student name string as arguments
+ * showAvailableCoursesForStudent() takes a CourseBinaryTree pointer,
+ * DegreeVector pointer, StudentBinaryTree pointer, and Student
+ * name string as arguments
  *
  * showAvailableCoursesForStudent() searches the StudentBinaryTree
  * for a Student with the given name, queryStudentName
  *
- * if found, then the DegreeVector is searched for the Student's
- * Degree program
+ * if found, then the Student's resolved Degree program is used
+ * (see getStudentDegree())
  *
  * if found, then each of the prerequisites of the Courses
  * in the Student's Degree program are compared to the Student's
@@ -538,8 +599,15 @@ void studentCoursesStillNeeded(DegreeVector *degListPtr, StudentBinaryTree *stud
  * if completed Courses are found to satisfy Degree Courses'
  * prereq requirements, then the available Course for the Student
  * is printed 
+ *
+ * the Student's available Courses are kept up to date as
+ * Courses are completed or removed (see
+ * getStudentAvailableSet()), so this only reads them
+ *
+ * the printed Vector is kept in the AuditCache, and printed
+ * from there while nothing it depends on has changed
  */
-void showAvailableCoursesForStudent(DegreeVector *degListPtr, StudentBinaryTree *studentTreePtr, char *queryStudentName) {
+void showAvailableCoursesForStudent(CourseBinaryTree *courseTreePtr, DegreeVector *degListPtr, StudentBinaryTree *studentTreePtr, AuditCache *auditCachePtr, char *queryStudentName) {
 
 	// checking for NULL pointer arguments
 	if (queryStudentName == NULL) {
@@ -549,6 +617,15 @@ void showAvailableCoursesForStudent(DegreeVector *degListPtr, StudentBinaryTree
 				"Student name argument\n");
 		return;
 	}
+	if (courseTreePtr == NULL) {
+		printf("\nCannot show available Courses for "
+				"%s in his or her Degree "
+				"program with a NULL "
+				"CourseBinaryTree pointer "
+				"argument\n",
+				queryStudentName);
+		return;
+	}
 	if (degListPtr == NULL) {
 		printf("\nCannot show available Courses for "
 				"%s in his or her Degree "
@@ -579,7 +656,7 @@ void showAvailableCoursesForStudent(DegreeVector *degListPtr, StudentBinaryTree
 	}
 	
 	char *studentDegreeName = studentNodePtr->studentPtr->degree;
-	Degree* studentDegreePtr = findInDegreeVector(degListPtr, studentDegreeName);
+	Degree* studentDegreePtr = getStudentDegree(studentNodePtr->studentPtr, degListPtr);
 	if (studentDegreePtr == NULL) {
 		printf("\nStudent's Degree %s is not in the "
 				"DegreeVector\n", 
@@ -587,16 +664,22 @@ void showAvailableCoursesForStudent(DegreeVector *degListPtr, StudentBinaryTree
 		return;
 	}
 
-	// with each of the Student's completed Courses, loop through all 
-	// of the Courses from the Student's Degree and compare their
-	// completed Course to the prerequisite Courses of each of the 
-	// Degree Courses
-	// if a completed Course is found to be a prerequisite for a 
-	// Degree Course then print the name of the Degree Course
-
-	Vector *completedCourses = studentNodePtr->studentPtr->completedCourses;
-	Vector *degreeCourses = studentDegreePtr->reqCourses;
-	printAvailableCourses(degreeCourses, completedCourses);
+	// the Degree Courses whose ids are in the Student's
+	// available set are printed in the order of the Degree
+
+	Student *studentPtr = studentNodePtr->studentPtr;
+	Vector *availableCourses = findAuditResult(auditCachePtr, studentPtr, AUDIT_AVAILABLE, studentDegreePtr, courseTreePtr);
+	bool cached = (availableCourses != NULL);
+	if (!cached) {
+		BitSet *availableSet = getStudentAvailableSet(studentPtr, courseTreePtr);
+		RequirementGroups *degreeGroups = getDegreeRequirementGroups(studentDegreePtr);
+		availableCourses = requirementsInSet(degreeGroups, availableSet);
+		cached = storeAuditResult(auditCachePtr, studentPtr, AUDIT_AVAILABLE, studentDegreePtr, courseTreePtr, availableCourses);
+	}
+	printVector(availableCourses);
+	if (!cached) {
+		freeVector(availableCourses);
+	}
 	
 	return;	
 }
@@ -675,20 +758,29 @@ void removeCourseFromDegree(DegreeVector *degListPtr, char **userInputArray) {
 }
 
 /*
- * removeCourseFromAll() takes a CourseBinaryTree pointer,
+ * removeCoursesFromAll() takes a CourseBinaryTree pointer,
  * DepartmentVector pointer, DegreeVector pointer, 
- * StudentBinaryTree pointer, and string array of the 
- * user's input as arguments
+ * StudentBinaryTree pointer, string array of the 
+ * user's input, and the number of strings in the
+ * array as arguments
  *
- * removeCourseFromAll() clears a given Course of all
+ * the first string is the Department name and every
+ * string after it is the name of a Course to remove
+ *
+ * removeCoursesFromAll() clears each given Course of all
  * of its information and removes it from all
  * Departments, Degrees, Students, and the main
  * CourseBinaryTree
  *
- * removeCourseFromAll() prints every updated
+ * the ids of the Courses are gathered in a BitSet so
+ * that the Department, each Degree, and each Student
+ * is compacted once for all of the Courses with
+ * removeCoursesFromVector()
+ *
+ * removeCoursesFromAll() prints every updated
  * Department, Degree, and Student to the terminal 
  */
-void removeCourseFromAll(CourseBinaryTree *courseTreePtr, DepartmentVector *depListPtr, DegreeVector *degListPtr, StudentBinaryTree *studentTreePtr, char **userInputArray) {
+void removeCoursesFromAll(CourseBinaryTree *courseTreePtr, DepartmentVector *depListPtr, DegreeVector *degListPtr, StudentBinaryTree *studentTreePtr, char **userInputArray, int numStrings) {
 
 	// checking for NULL pointer arguments
 	if (userInputArray == NULL) {
@@ -713,8 +805,7 @@ void removeCourseFromAll(CourseBinaryTree *courseTreePtr, DepartmentVector *depL
 				"argument\n");
 		return;
 	}
-	char *courseName = userInputArray[1];
-	if (courseName == NULL) {
+	if (numStrings < 2 || userInputArray[1] == NULL) {
 		printf("\nCannot remove Course from "
 				"the %s Department, "
 				"all Degrees, all "
@@ -725,6 +816,7 @@ void removeCourseFromAll(CourseBinaryTree *courseTreePtr, DepartmentVector *depL
 				departmentName);
 		return;
 	}
+	char *courseName = userInputArray[1];
 	if (courseTreePtr == NULL) {
 		printf("\nCannot remove %s from the %s "
 				"Department, all Degrees, all "
@@ -782,39 +874,896 @@ void removeCourseFromAll(CourseBinaryTree *courseTreePtr, DepartmentVector *depL
 			       	courseName, departmentName);
 		return;
 	}
-	CourseBTNode *courseNode = findInCourseBinaryTree(courseTreePtr->root, courseName);
-	if (courseNode == NULL) {
-		printf("\nCOURSE NOT FOUND\n");
+
+	// gathering the ids of the Courses that exist and
+	// clearing each Course's information
+	BitSet *courseIds = initBitSet(courseTreePtr->numCourseIds);
+	char **removedNames = (char**) malloc(numStrings * sizeof(char*));
+	int numRemoved = 0;
+	for (int i = 1; i < numStrings; i++) {
+		CourseBTNode *courseNode = findInCourseBinaryTree(courseTreePtr->root, userInputArray[i]);
+		if (courseNode == NULL) {
+			printf("\nCOURSE NOT FOUND\n");
+			continue;
+		}
+		Course *coursePtr = courseNode->coursePtr;
+		if ( testBit(courseIds, coursePtr->id) ) {
+			continue;
+		}
+		setBit(courseIds, coursePtr->id);
+		removedNames[numRemoved] = userInputArray[i];
+		numRemoved++;
+		coursePtr->title = NULL;
+		coursePtr->depName = NULL;
+		clearLinkedList( &(coursePtr->firstDegree) );
+		clearCoursePrerequisites(coursePtr);
+		compileCoursePrerequisites(courseTreePtr, coursePtr);
+	}
+	if (numRemoved == 0) {
+		free(removedNames);
+		freeBitSet(courseIds);
 		return;
 	}
-	Course *coursePtr = courseNode->coursePtr;
-	coursePtr->title = NULL;
-	coursePtr->depName = NULL;
-	clearLinkedList( &(coursePtr->firstDegree) );
-	clearLinkedList( &(coursePtr->firstPrereq) );
 
-	// remove Course pointer from the Department and all Degrees
-	removeCoursePtrFromVector(depPtr->depCourses, courseName);
-	// remove Course name from all prerequisites
-	removeCourseFromAllPrereqs(courseTreePtr, courseName);
+	// remove Course pointers from the Department
+	removeCoursesFromVector(depPtr->depCourses, courseIds);
+	// remove the Courses from all prerequisites, gathering
+	// the Courses that required them with the removed ones
+	BitSet *changedIds = initBitSet(courseTreePtr->numCourseIds);
+	unionBits(changedIds, courseIds);
+	removeCoursesFromAllPrereqs(courseTreePtr, courseIds, changedIds);
+	// dropping the Courses from every prerequisite closure
+	updatePrereqClosures(courseTreePtr, changedIds);
+	freeBitSet(changedIds);
 	// print department
 	printDepartment(depPtr);
 
+	// remove Course pointers from all Degrees
 	for (int i = 0; i < degListPtr->numDegs; i++) {
-		Degree *degPtr = degListPtr->degrees+i;
-		if ( findCoursePtrInVector(degPtr->reqCourses, courseName) != NULL) {
-			removeCoursePtrFromVector(degPtr->reqCourses, courseName);
+		Degree *degPtr = getDegreeAt(degListPtr, i);
+		if ( removeCoursesFromVector(degPtr->reqCourses, courseIds) > 0 ) {
 			// print degree
 			printDegree(degPtr);
 		}
 	}
 
 	// remove from Student's completed Courses
-	removeCompletedCourseFromAllStudents(studentTreePtr, courseName);
+	removeCompletedCoursesFromAllStudents(studentTreePtr, courseIds);
 
-	// remove Course from the Binary Tree
-	removeFromCourseBinaryTree(courseTreePtr, courseName);
-	
+	// remove Courses from the Binary Tree
+	for (int i = 0; i < numRemoved; i++) {
+		removeFromCourseBinaryTree(courseTreePtr, removedNames[i]);
+	}
+
+	free(removedNames);
+	freeBitSet(courseIds);
 	return;
 
 }
+
+/*
+ * printCompletionShare() prints a number of Students
+ * out of a total and the matching percentage
+ */
+void printCompletionShare(unsigned int numCompleted, unsigned int numTotal) {
+
+	if (numTotal == 0) {
+		printf("%u of 0 Students\n", numCompleted);
+		return;
+	}
+	printf("%u of %u Students (%.1f%%)\n", numCompleted, numTotal, (100.0 * numCompleted) / numTotal);
+	return;
+}
+
+/*
+ * traverseAndTallyCourse() takes a CourseBTNode pointer
+ * and a CompletionStore pointer as arguments
+ *
+ * traverseAndTallyCourse() traverses the tree/subtree
+ * in order and prints each Course's name with the
+ * number of Students who have completed it
+ */
+void traverseAndTallyCourse(CourseBTNode *nodePtr, CompletionStore *storePtr) {
+
+	// passed leaf node
+	if (nodePtr == NULL) {
+		return;
+	}
+
+	traverseAndTallyCourse(nodePtr->left, storePtr);
+	printf("%s: %u\n", nodePtr->coursePtr->name, countCourseCompletions(storePtr, nodePtr->coursePtr));
+	traverseAndTallyCourse(nodePtr->right, storePtr);
+	return;
+}
+
+/*
+ * tallyAllCourseCompletions() takes a CourseBinaryTree
+ * pointer and a CompletionStore pointer as arguments
+ *
+ * tallyAllCourseCompletions() prints every Course on
+ * the CourseBinaryTree with the number of Students who
+ * have completed it - each number is the population
+ * count of the Course's column in the CompletionStore
+ */
+void tallyAllCourseCompletions(CourseBinaryTree *courseTreePtr, CompletionStore *storePtr) {
+
+	// checking for NULL pointer arguments
+	if (courseTreePtr == NULL) {
+		printf("\nCannot tally Course completions "
+				"with NULL CourseBinaryTree "
+				"pointer argument\n");
+		return;
+	}
+	if (storePtr == NULL) {
+		printf("\nCannot tally Course completions "
+				"with NULL CompletionStore "
+				"pointer argument\n");
+		return;
+	}
+
+	printf("\nCompletions out of %u Students:\n", storePtr->numStudents);
+	traverseAndTallyCourse(courseTreePtr->root, storePtr);
+	return;
+}
+
+/*
+ * tallyCourseCompletions() takes a CourseBinaryTree
+ * pointer, a CompletionStore pointer and a Course name
+ * as arguments
+ *
+ * if the Course is found, tallyCourseCompletions()
+ * prints how many of all the Students have completed
+ * the Course
+ */
+void tallyCourseCompletions(CourseBinaryTree *courseTreePtr, CompletionStore *storePtr, char *queryCourseName) {
+
+	// checking for NULL pointer arguments
+	if (queryCourseName == NULL) {
+		printf("\nCannot tally Course completions "
+				"with no Course name "
+				"argument\n");
+		return;
+	}
+	if (courseTreePtr == NULL || storePtr == NULL) {
+		printf("\nCannot tally %s completions with "
+				"NULL CourseBinaryTree or "
+				"CompletionStore pointer "
+				"argument\n", queryCourseName);
+		return;
+	}
+
+	CourseBTNode *courseNode = findInCourseBinaryTree(courseTreePtr->root, queryCourseName);
+	if (courseNode == NULL) {
+		printf("\nCOURSE NOT FOUND\n");
+		return;
+	}
+	printf("%s completed by ", queryCourseName);
+	printCompletionShare(countCourseCompletions(storePtr, courseNode->coursePtr), storePtr->numStudents);
+	return;
+}
+
+/*
+ * tallyCourseCompletionsByDegree() takes a 
+ * CourseBinaryTree pointer, a CompletionStore pointer
+ * and a Course name as arguments
+ *
+ * if the Course is found, then for each Degree program
+ * held by at least one Student, 
+ * tallyCourseCompletionsByDegree() intersects the
+ * Degree's column with the Course's column and prints
+ * how many of the Degree's Students have completed
+ * the Course
+ */
+void tallyCourseCompletionsByDegree(CourseBinaryTree *courseTreePtr, CompletionStore *storePtr, char *queryCourseName) {
+
+	// checking for NULL pointer arguments
+	if (queryCourseName == NULL) {
+		printf("\nCannot tally Course completions "
+				"by Degree with no Course "
+				"name argument\n");
+		return;
+	}
+	if (courseTreePtr == NULL || storePtr == NULL) {
+		printf("\nCannot tally %s completions by "
+				"Degree with NULL "
+				"CourseBinaryTree or "
+				"CompletionStore pointer "
+				"argument\n", queryCourseName);
+		return;
+	}
+
+	CourseBTNode *courseNode = findInCourseBinaryTree(courseTreePtr->root, queryCourseName);
+	if (courseNode == NULL) {
+		printf("\nCOURSE NOT FOUND\n");
+		return;
+	}
+	if (storePtr->numDegrees == 0) {
+		printf("\nNO STUDENT DEGREES ON RECORD\n");
+		return;
+	}
+	printf("\n%s completed by:\n", queryCourseName);
+	for (unsigned int i = 0; i < storePtr->numDegrees; i++) {
+		printf("%s: ", storePtr->degreeNames[i]);
+		printCompletionShare(countDegreeCourseCompletions(storePtr, i, courseNode->coursePtr), countDegreeStudents(storePtr, i));
+	}
+	return;
+}
+
+/*
+ * tallyJointCourseCompletions() takes a CourseBinaryTree
+ * pointer, a CompletionStore pointer, and the user's
+ * array of Course name strings as arguments
+ *
+ * if both Courses are found, tallyJointCourseCompletions()
+ * intersects their columns and prints how many Students
+ * have completed both Courses
+ */
+void tallyJointCourseCompletions(CourseBinaryTree *courseTreePtr, CompletionStore *storePtr, char **userInputArray, int numStrings) {
+
+	// checking for NULL pointer arguments and
+	// valid user input
+	if (userInputArray == NULL || numStrings < 2) {
+		printf("\nCannot tally joint Course "
+				"completions without two "
+				"Course name arguments\n");
+		return;
+	}
+	if (courseTreePtr == NULL || storePtr == NULL) {
+		printf("\nCannot tally joint Course "
+				"completions with NULL "
+				"CourseBinaryTree or "
+				"CompletionStore pointer "
+				"argument\n");
+		return;
+	}
+
+	CourseBTNode *firstNode = findInCourseBinaryTree(courseTreePtr->root, userInputArray[0]);
+	CourseBTNode *secondNode = findInCourseBinaryTree(courseTreePtr->root, userInputArray[1]);
+	if (firstNode == NULL || secondNode == NULL) {
+		printf("\nCOURSE NOT FOUND\n");
+		return;
+	}
+	printf("%s and %s completed by ", userInputArray[0], userInputArray[1]);
+	printCompletionShare(countJointCourseCompletions(storePtr, firstNode->coursePtr, secondNode->coursePtr), storePtr->numStudents);
+	return;
+}
+
+/*
+ * printPrerequisiteChain() takes a CourseBinaryTree pointer, a
+ * StudentBinaryTree pointer, and the user's array of strings -
+ * a Course name and, optionally, a Student name - as arguments
+ *
+ * printPrerequisiteChain() prints every transitive prerequisite
+ * of the Course, each after its own prerequisites, from the
+ * Course's precomputed closure (see prereqClosure.h)
+ *
+ * if a Student name is given, the Student's completed Courses
+ * are left out, so only what remains of the chain is printed
+ */
+void printPrerequisiteChain(CourseBinaryTree *courseTreePtr, StudentBinaryTree *studentTreePtr, char **userInputArray, int numStrings) {
+
+	// checking for NULL pointer arguments and
+	// valid user input
+	if (userInputArray == NULL || numStrings < 1) {
+		printf("\nCannot print a prerequisite "
+				"chain without a Course "
+				"name argument\n");
+		return;
+	}
+	if (courseTreePtr == NULL || studentTreePtr == NULL) {
+		printf("\nCannot print the prerequisite "
+				"chain of %s with NULL "
+				"CourseBinaryTree or "
+				"StudentBinaryTree pointer "
+				"argument\n", userInputArray[0]);
+		return;
+	}
+
+	CourseBTNode *courseNode = findInCourseBinaryTree(courseTreePtr->root, userInputArray[0]);
+	if (courseNode == NULL) {
+		printf("\nCOURSE NOT FOUND\n");
+		return;
+	}
+
+	// the Student's completed Courses, if a Student is given
+	BitSet *completedSet = NULL;
+	if (numStrings > 1) {
+		StudentBTNode *studentNodePtr = findInStudentBinaryTree(studentTreePtr->root, userInputArray[1]);
+		if (studentNodePtr == NULL) {
+			printf("\nStudent %s does not exist in the "
+					"StudentBinaryTree\n",
+					userInputArray[1]);
+			return;
+		}
+		completedSet = getStudentCompletedSet(studentNodePtr->studentPtr);
+	}
+
+	Vector *chainPtr = prereqChain(courseTreePtr, courseNode->coursePtr, completedSet);
+	if (chainPtr->numElements > 0) {
+		printVector(chainPtr);
+	} else if (completedSet == NULL || courseNode->coursePtr->prereqExpr == NULL) {
+		printf("\nNO PREREQUISITES\n");
+	} else {
+		printf("\nALL PREREQUISITES COMPLETED\n");
+	}
+	freeVector(chainPtr);
+	return;
+}
+
+/*
+ * planStudentGraduation() takes a CourseBinaryTree pointer, a
+ * DegreeVector pointer, a StudentBinaryTree pointer, and the
+ * user's array of strings - a Student name and, optionally,
+ * the most Courses per term - as arguments
+ *
+ * planStudentGraduation() plans the Courses the Student
+ * still needs for his or her Degree program term by term
+ * (see graduationPlan.h) and prints the plan
+ */
+void planStudentGraduation(CourseBinaryTree *courseTreePtr, DegreeVector *degListPtr, StudentBinaryTree *studentTreePtr, char **userInputArray, int numStrings) {
+
+	// checking for NULL pointer arguments and
+	// valid user input
+	if (userInputArray == NULL || numStrings < 1) {
+		printf("\nCannot plan graduation without "
+				"a Student name argument\n");
+		return;
+	}
+	if (courseTreePtr == NULL || degListPtr == NULL || studentTreePtr == NULL) {
+		printf("\nCannot plan graduation for %s "
+				"with NULL CourseBinaryTree, "
+				"DegreeVector, or "
+				"StudentBinaryTree pointer "
+				"argument\n", userInputArray[0]);
+		return;
+	}
+
+	int coursesPerTerm = DEFAULT_COURSES_PER_TERM;
+	if (numStrings > 1) {
+		coursesPerTerm = atoi(userInputArray[1]);
+		if (coursesPerTerm <= 0) {
+			printf("\nCourses per term must be a "
+					"positive number\n");
+			return;
+		}
+	}
+
+	StudentBTNode *studentNodePtr = findInStudentBinaryTree(studentTreePtr->root, userInputArray[0]);
+	if (studentNodePtr == NULL) {
+		printf("\nStudent %s does not exist in the "
+				"StudentBinaryTree\n",
+				userInputArray[0]);
+		return;
+	}
+	Degree *studentDegreePtr = getStudentDegree(studentNodePtr->studentPtr, degListPtr);
+	if (studentDegreePtr == NULL) {
+		printf("\nStudent's Degree %s is not in the "
+				"DegreeVector\n",
+				studentNodePtr->studentPtr->degree);
+		return;
+	}
+
+	BitSet *completedSet = getStudentCompletedSet(studentNodePtr->studentPtr);
+	RequirementGroups *degreeGroups = getDegreeRequirementGroups(studentDegreePtr);
+	GraduationPlan *planPtr = planGraduation(courseTreePtr, degreeGroups, completedSet, coursesPerTerm);
+	if (planPtr->numCourses == 0) {
+		printf("\nALL REQUIREMENTS COMPLETED\n");
+	} else {
+		printGraduationPlan(planPtr);
+	}
+	freeGraduationPlan(planPtr);
+	return;
+}
+
+/*
+ * printNewlyAvailable() takes a label string, a
+ * CourseBinaryTree pointer, and a BitSet pointer of
+ * Course ids as arguments and prints the label and the
+ * names of the Courses, separated by commas, or "none"
+ */
+void printNewlyAvailable(char *label, CourseBinaryTree *courseTreePtr, BitSet *courseIds) {
+
+	printf("%s: ", label);
+	bool first = true;
+	for (unsigned int w = 0; w < courseIds->numWords; w++) {
+		uint64_t bits = courseIds->words[w];
+		while (bits != 0) {
+			unsigned int courseId = w * 64 + __builtin_ctzll(bits);
+			bits &= bits - 1;
+			printf("%s%s", first ? "" : ", ", courseTreePtr->coursesById[courseId]->name);
+			first = false;
+		}
+	}
+	printf("%s\n", first ? "none" : "");
+	return;
+}
+
+/*
+ * showWhatIfCompleted() takes a CourseBinaryTree pointer, a
+ * DegreeVector pointer, a StudentBinaryTree pointer, and the
+ * user's array of strings - a Student name and one or more
+ * Course names - as arguments
+ *
+ * showWhatIfCompleted() prints, for each Course on its
+ * own, what would change if the Student completed it:
+ * the Courses that would become available, in and outside
+ * of the Student's Degree program, and the Degree Courses
+ * that would be left
+ *
+ * nothing about the Student is changed - each Course is
+ * checked against the Student's kept Availability (see
+ * getStudentAvailableSet()), and only the Courses that
+ * require it and the requirement groups that have it
+ * are looked at
+ */
+void showWhatIfCompleted(CourseBinaryTree *courseTreePtr, DegreeVector *degListPtr, StudentBinaryTree *studentTreePtr, char **userInputArray, int numStrings) {
+
+	// checking for NULL pointer arguments and
+	// valid user input
+	if (userInputArray == NULL || numStrings < 2) {
+		printf("\nCannot show what completing a "
+				"Course would change without a "
+				"Student name and Course name "
+				"argument\n");
+		return;
+	}
+	if (courseTreePtr == NULL || degListPtr == NULL || studentTreePtr == NULL) {
+		printf("\nCannot show what completing a "
+				"Course would change for %s "
+				"with NULL CourseBinaryTree, "
+				"DegreeVector, or "
+				"StudentBinaryTree pointer "
+				"argument\n", userInputArray[0]);
+		return;
+	}
+
+	StudentBTNode *studentNodePtr = findInStudentBinaryTree(studentTreePtr->root, userInputArray[0]);
+	if (studentNodePtr == NULL) {
+		printf("\nStudent %s does not exist in the "
+				"StudentBinaryTree\n",
+				userInputArray[0]);
+		return;
+	}
+	Student *studentPtr = studentNodePtr->studentPtr;
+	Degree *studentDegreePtr = getStudentDegree(studentPtr, degListPtr);
+	if (studentDegreePtr == NULL) {
+		printf("\nStudent's Degree %s is not in the "
+				"DegreeVector\n",
+				studentPtr->degree);
+		return;
+	}
+
+	// the Student's state is read once for every Course
+	getStudentAvailableSet(studentPtr, courseTreePtr);
+	BitSet *completedSet = getStudentCompletedSet(studentPtr);
+	RequirementGroups *degreeGroups = getDegreeRequirementGroups(studentDegreePtr);
+	int numMissing = countMissingRequirements(degreeGroups, completedSet);
+
+	BitSet *degreeIds = initBitSet(courseTreePtr->numCourseIds);
+	for (unsigned int i = 0; i < degreeGroups->numCourses; i++) {
+		setBit(degreeIds, degreeGroups->courseIds[i]);
+	}
+	BitSet *unlockedSet = initBitSet(courseTreePtr->numCourseIds);
+
+	for (int i = 1; i < numStrings; i++) {
+		CourseBTNode *courseNode = findInCourseBinaryTree(courseTreePtr->root, userInputArray[i]);
+		if (courseNode == NULL) {
+			printf("\nCourse %s does not exist in the "
+					"CourseBinaryTree\n",
+					userInputArray[i]);
+			continue;
+		}
+		Course *coursePtr = courseNode->coursePtr;
+		if ( testBit(completedSet, coursePtr->id) ) {
+			printf("\n%s has already completed %s\n",
+					studentPtr->name, coursePtr->name);
+			continue;
+		}
+
+		clearAllBits(unlockedSet);
+		unlockedIfCompleted(studentPtr->availability, completedSet, coursePtr->id, unlockedSet);
+		int numFulfilled = countFulfilledIfCompleted(degreeGroups, completedSet, coursePtr->id);
+
+		printf("\nIf %s completes %s:\n", studentPtr->name, coursePtr->name);
+		unsigned int numUnlocked = countBits(unlockedSet);
+		unsigned int numInDegree = countBitsInIntersection(unlockedSet, degreeIds);
+		printf("%u newly available (%u in the Degree)\n", numUnlocked, numInDegree);
+		if (numUnlocked > 0) {
+			BitSet *outsideSet = initBitSet(courseTreePtr->numCourseIds);
+			unionBits(outsideSet, unlockedSet);
+			for (unsigned int w = 0; w < outsideSet->numWords && w < degreeIds->numWords; w++) {
+				unlockedSet->words[w] &= degreeIds->words[w];
+				outsideSet->words[w] &= ~degreeIds->words[w];
+			}
+			printNewlyAvailable("In the Degree", courseTreePtr, unlockedSet);
+			printNewlyAvailable("Outside the Degree", courseTreePtr, outsideSet);
+			freeBitSet(outsideSet);
+		}
+		printf("Degree Courses left: %d -> %d\n", numMissing, numMissing - numFulfilled);
+	}
+
+	freeBitSet(degreeIds);
+	freeBitSet(unlockedSet);
+	return;
+}
+
+/*
+ * findDegreeOfColumn() takes a CompletionStore pointer, the
+ * index of a Degree column, and a DegreeVector pointer as
+ * arguments and returns the Degree of the column's first
+ * Student, or NULL if it is not in the DegreeVector
+ */
+Degree* findDegreeOfColumn(CompletionStore *storePtr, unsigned int degreeIndex, DegreeVector *degListPtr) {
+
+	BitSet *columnPtr = storePtr->degreeColumns[degreeIndex];
+	for (unsigned int w = 0; w < columnPtr->numWords; w++) {
+		if (columnPtr->words[w] != 0) {
+			unsigned int row = w * 64 + __builtin_ctzll(columnPtr->words[w]);
+			return getStudentDegree(storePtr->students[row], degListPtr);
+		}
+	}
+	return NULL;
+}
+
+#ifdef COMMAND_TIMING
+/*
+ * printAvailabilityThroughput() takes an AvailabilityMatrix
+ * pointer as an argument, evaluates it again for at least
+ * 50 milliseconds, for a steady measurement, and prints
+ * the throughput in Student-Courses per second
+ */
+void printAvailabilityThroughput(AvailabilityMatrix *matrixPtr) {
+
+	unsigned int numPasses = 0;
+	clock_t start = clock();
+	clock_t elapsed = 0;
+	do {
+		evaluateAvailabilityMatrix(matrixPtr);
+		numPasses++;
+		elapsed = clock() - start;
+	} while (elapsed < CLOCKS_PER_SEC / 20);
+	double seconds = (double) elapsed / CLOCKS_PER_SEC;
+	double numEvaluated = (double) matrixPtr->numStudents * matrixPtr->numCourseIds * numPasses;
+	printf("Evaluated %u Students x %u Courses %u times: %.1f million Student-Courses per second\n",
+			matrixPtr->numStudents, matrixPtr->numCourseIds, numPasses,
+			numEvaluated / seconds / 1000000.0);
+	return;
+}
+
+/*
+ * microsecondsSince() takes the time a command started as
+ * an argument and returns the microseconds since then
+ */
+double microsecondsSince(struct timespec start) {
+
+	struct timespec end;
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	return (end.tv_sec - start.tv_sec) * 1000000.0 + (end.tv_nsec - start.tv_nsec) / 1000.0;
+}
+#endif
+
+/*
+ * tallyAvailableCourses() takes a CourseBinaryTree pointer, a
+ * DegreeVector pointer, a StudentBinaryTree pointer, and a
+ * CompletionStore pointer as arguments
+ *
+ * tallyAvailableCourses() evaluates every Student's available
+ * Courses at once in an AvailabilityMatrix (see
+ * availabilityMatrix.h) and prints, for each Degree program
+ * held by at least one Student, how many of the program's
+ * Courses its Students can take next, added up over the
+ * Students
+ */
+void tallyAvailableCourses(CourseBinaryTree *courseTreePtr, DegreeVector *degListPtr, StudentBinaryTree *studentTreePtr, CompletionStore *storePtr) {
+
+	// checking for NULL pointer arguments
+	if (courseTreePtr == NULL || degListPtr == NULL || studentTreePtr == NULL || storePtr == NULL) {
+		printf("\nCannot tally available Courses "
+				"with NULL CourseBinaryTree, "
+				"DegreeVector, "
+				"StudentBinaryTree, or "
+				"CompletionStore pointer "
+				"argument\n");
+		return;
+	}
+
+	refreshCompletionStore(storePtr, studentTreePtr, courseTreePtr);
+	AvailabilityMatrix *matrixPtr = buildAvailabilityMatrix(storePtr, courseTreePtr);
+
+	printf("\nAvailable Degree Courses out of %u Students:\n", storePtr->numStudents);
+	BitSet *countedIds = initBitSet(courseTreePtr->numCourseIds);
+	for (unsigned int i = 0; i < storePtr->numDegrees; i++) {
+		printf("%s: ", storePtr->degreeNames[i]);
+		Degree *degreePtr = findDegreeOfColumn(storePtr, i, degListPtr);
+		if (degreePtr == NULL) {
+			printf("Degree is not in the DegreeVector\n");
+			continue;
+		}
+		// a Course in more than one requirement group is
+		// counted once
+		RequirementGroups *groupsPtr = getDegreeRequirementGroups(degreePtr);
+		unsigned int numAvailable = 0;
+		clearAllBits(countedIds);
+		for (unsigned int j = 0; j < groupsPtr->numCourses; j++) {
+			unsigned int courseId = groupsPtr->courseIds[j];
+			if ( testBit(countedIds, courseId) ) {
+				continue;
+			}
+			setBit(countedIds, courseId);
+			numAvailable += countAvailableRows(matrixPtr, courseId, storePtr->degreeColumns[i]);
+		}
+		printf("%u available to %u Students\n", numAvailable, countDegreeStudents(storePtr, i));
+	}
+	freeBitSet(countedIds);
+
+#ifdef COMMAND_TIMING
+	printAvailabilityThroughput(matrixPtr);
+#endif
+
+	freeAvailabilityMatrix(matrixPtr);
+	return;
+}
+
+/*
+ * auditAllStudents() takes a CourseBinaryTree pointer, a
+ * DegreeVector pointer, a StudentBinaryTree pointer, a
+ * CompletionStore pointer, an array of strings from the
+ * user's input, and the number of strings as arguments
+ *
+ * the first string is the name of the report file and
+ * the optional second string a Degree name - only the
+ * Students in that Degree program are audited
+ *
+ * auditAllStudents() audits the Students in alphabetical
+ * order, as the CompletionStore holds them, writes the
+ * report file, and prints a summary
+ */
+void auditAllStudents(CourseBinaryTree *courseTreePtr, DegreeVector *degListPtr, StudentBinaryTree *studentTreePtr, CompletionStore *storePtr, char **userInputArray, int numStrings) {
+
+	// checking for NULL pointer arguments and
+	// valid user input
+	if (userInputArray == NULL || numStrings < 1 || userInputArray[0][0] == '\0') {
+		printf("\nCannot audit Students without "
+				"a report file name "
+				"argument\n");
+		return;
+	}
+	if (courseTreePtr == NULL || degListPtr == NULL || studentTreePtr == NULL || storePtr == NULL) {
+		printf("\nCannot audit Students "
+				"with NULL CourseBinaryTree, "
+				"DegreeVector, "
+				"StudentBinaryTree, or "
+				"CompletionStore pointer "
+				"argument\n");
+		return;
+	}
+	char *reportName = userInputArray[0];
+	char *degreeName = (numStrings >= 2) ? userInputArray[1] : NULL;
+
+	// gathering the Students to audit
+	refreshCompletionStore(storePtr, studentTreePtr, courseTreePtr);
+	Student **students = (Student**) malloc( (storePtr->numStudents + 1) * sizeof(Student*) );
+	unsigned int numStudents = 0;
+	for (unsigned int i = 0; i < storePtr->numStudents; i++) {
+		Student *studentPtr = storePtr->students[i];
+		if ( degreeName == NULL || (studentPtr->degree != NULL && strcmp(studentPtr->degree, degreeName) == 0) ) {
+			students[numStudents] = studentPtr;
+			numStudents++;
+		}
+	}
+	if (numStudents == 0) {
+		if (degreeName == NULL) {
+			printf("\nThere are no Students to audit\n");
+		} else {
+			printf("\nNo Student is in the Degree program %s\n", degreeName);
+		}
+		free(students);
+		return;
+	}
+
+	FILE *reportFile = fopen(reportName, "w");
+	if (reportFile == NULL) {
+		printf("\nCannot open the report file %s for writing\n", reportName);
+		free(students);
+		return;
+	}
+
+#ifdef COMMAND_TIMING
+	struct timespec start;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+#endif
+	DegreeAudit *auditPtr = runDegreeAudit(students, numStudents, degListPtr);
+#ifdef COMMAND_TIMING
+	double microseconds = microsecondsSince(start);
+#endif
+	if (auditPtr == NULL) {
+		fclose(reportFile);
+		free(students);
+		return;
+	}
+	writeDegreeAudit(auditPtr, reportFile);
+	fclose(reportFile);
+
+	unsigned int numComplete = 0;
+	unsigned int numUnknown = 0;
+	for (unsigned int i = 0; i < auditPtr->numStudents; i++) {
+		if (auditPtr->audits[i].degreePtr == NULL) {
+			numUnknown++;
+		} else if (auditPtr->audits[i].numMissing == 0) {
+			numComplete++;
+		}
+	}
+	printf("\nAudited %u Students\n", auditPtr->numStudents);
+	printf("%u complete, %u incomplete, %u with an unknown Degree\n",
+			numComplete, auditPtr->numStudents - numComplete - numUnknown, numUnknown);
+	printf("Report written to %s\n", reportName);
+#ifdef COMMAND_TIMING
+	printf("Audit took %.3f ms on %u threads\n", microseconds / 1000.0, auditPtr->numThreads);
+#endif
+
+	freeDegreeAudit(auditPtr);
+	free(students);
+	return;
+}
+
+/*
+ * rankStudentsByGraduation() takes a CourseBinaryTree
+ * pointer, a DegreeVector pointer, a StudentBinaryTree
+ * pointer, a CompletionStore pointer, an array of
+ * strings from the user's input, and the number of
+ * strings as arguments
+ *
+ * the first string is k, the number of Students to
+ * list, and the optional second string a Degree name -
+ * only the Students in that Degree program are ranked
+ *
+ * rankStudentsByGraduation() ranks every Student, in the
+ * alphabetical order the CompletionStore holds them (so
+ * ties are listed alphabetically), and prints the k
+ * closest to graduating
+ */
+void rankStudentsByGraduation(CourseBinaryTree *courseTreePtr, DegreeVector *degListPtr, StudentBinaryTree *studentTreePtr, CompletionStore *storePtr, char **userInputArray, int numStrings) {
+
+	// checking for NULL pointer arguments and
+	// valid user input
+	if (userInputArray == NULL || numStrings < 1) {
+		printf("\nCannot rank Students without "
+				"a number of Students "
+				"argument\n");
+		return;
+	}
+	if (courseTreePtr == NULL || degListPtr == NULL || studentTreePtr == NULL || storePtr == NULL) {
+		printf("\nCannot rank Students "
+				"with NULL CourseBinaryTree, "
+				"DegreeVector, "
+				"StudentBinaryTree, or "
+				"CompletionStore pointer "
+				"argument\n");
+		return;
+	}
+	int k = atoi(userInputArray[0]);
+	if (k <= 0) {
+		printf("\nNumber of Students must be a "
+				"positive number\n");
+		return;
+	}
+	Degree *degreeFilter = NULL;
+	if (numStrings >= 2) {
+		degreeFilter = findInDegreeVector(degListPtr, userInputArray[1]);
+		if (degreeFilter == NULL) {
+			printf("\nDegree %s is not in the "
+					"DegreeVector\n",
+					userInputArray[1]);
+			return;
+		}
+	}
+
+	refreshCompletionStore(storePtr, studentTreePtr, courseTreePtr);
+#ifdef COMMAND_TIMING
+	struct timespec start;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+#endif
+	GraduationRanking *rankingPtr = rankClosestToGraduation(storePtr->students, storePtr->numStudents, degListPtr, degreeFilter, (unsigned int) k);
+#ifdef COMMAND_TIMING
+	double microseconds = microsecondsSince(start);
+#endif
+	if (rankingPtr == NULL) {
+		return;
+	}
+
+	if (rankingPtr->numClosest == 0) {
+		printf("\nNo Student is in %s\n", (degreeFilter == NULL) ? "a known Degree program" : degreeFilter->name);
+	} else {
+		printf("\nClosest to graduation:\n");
+	}
+	for (unsigned int i = 0; i < rankingPtr->numClosest; i++) {
+		GraduationCandidate candidate = rankingPtr->closest[i];
+		printf("%u. %s (%s): %u requirement group%s left\n", i + 1,
+				candidate.studentPtr->name, candidate.studentPtr->degree,
+				candidate.numMissing, (candidate.numMissing == 1) ? "" : "s");
+	}
+	printf("Ranked %u Students\n", rankingPtr->numAudited);
+#ifdef COMMAND_TIMING
+	printf("Ranking took %.3f ms on %u threads\n", microseconds / 1000.0, rankingPtr->numThreads);
+#endif
+
+	freeGraduationRanking(rankingPtr);
+	return;
+}
+
+/*
+ * compareStudentAcrossDegrees() takes a DegreeVector
+ * pointer, a StudentBinaryTree pointer, and a Student
+ * name string as arguments
+ *
+ * compareStudentAcrossDegrees() searches the
+ * StudentBinaryTree for the Student and audits the
+ * Student's completed Courses against every Degree
+ * program of the DegreeVector at once (see
+ * auditAcrossDegrees()), without changing the Student
+ *
+ * the Degree programs are printed with the fewest
+ * requirement groups left first, the Student's own
+ * Degree marked
+ */
+void compareStudentAcrossDegrees(DegreeVector *degListPtr, StudentBinaryTree *studentTreePtr, char *queryStudentName) {
+
+	// checking for NULL pointer arguments
+	if (queryStudentName == NULL) {
+		printf("\nCannot audit a Student across "
+				"Degree programs without a "
+				"Student name argument\n");
+		return;
+	}
+	if (degListPtr == NULL || studentTreePtr == NULL) {
+		printf("\nCannot audit %s across Degree "
+				"programs with NULL DegreeVector "
+				"or StudentBinaryTree pointer "
+				"argument\n", queryStudentName);
+		return;
+	}
+
+	StudentBTNode *studentNodePtr = findInStudentBinaryTree(studentTreePtr->root, queryStudentName);
+	if (studentNodePtr == NULL) {
+		printf("\nStudent %s is not in the "
+				"StudentBinaryTree\n",
+				queryStudentName);
+		return;
+	}
+	if (degListPtr->numDegs == 0) {
+		printf("\nNo Degree programs to audit "
+				"%s against\n", queryStudentName);
+		return;
+	}
+	Student *studentPtr = studentNodePtr->studentPtr;
+	Degree *studentDegreePtr = getStudentDegree(studentPtr, degListPtr);
+
+#ifdef COMMAND_TIMING
+	struct timespec start;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+#endif
+	CrossDegreeAudit *crossAuditPtr = auditAcrossDegrees(studentPtr, degListPtr);
+#ifdef COMMAND_TIMING
+	double microseconds = microsecondsSince(start);
+#endif
+	if (crossAuditPtr == NULL) {
+		return;
+	}
+
+	printf("\nDegree programs for %s, fewest requirement groups left first:\n", studentPtr->name);
+	for (unsigned int i = 0; i < crossAuditPtr->numOptions; i++) {
+		DegreeOption option = crossAuditPtr->options[i];
+		printf("%u. %s%s: %u of %u requirement group%s left (%d Course%s)\n", i + 1,
+				option.degreePtr->name,
+				(option.degreePtr == studentDegreePtr) ? " (current)" : "",
+				option.numMissing, option.numGroups, (option.numGroups == 1) ? "" : "s",
+				option.numMissingCourses, (option.numMissingCourses == 1) ? "" : "s");
+	}
+#ifdef COMMAND_TIMING
+	printf("Audited %u Degree programs in %.3f us (%.3f us per Degree)\n",
+			crossAuditPtr->numOptions, microseconds, microseconds / crossAuditPtr->numOptions);
+#endif
+
+	freeCrossDegreeAudit(crossAuditPtr);
+	return;
+}
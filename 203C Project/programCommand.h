@@ -11,13 +11,26 @@
  *	a - addCourseToDepartment()
  *	m - studentCoursesStillNeeded()
  *	n - showAvailableCoursesForStudent()
- *	r - removeCourseFromAll()
+ *	r - removeCoursesFromAll()
  *	p - handleCmdP()
  *		c - findAndPrintCourse2()
  *		d - findAndPrintDepartment()
  *		g - findAndPrintDegree()
  *		s - findAndPrintStudent()
  *	q - removeCourseFromDegree()
+ *	t - handleCmdT()
+ *		a - tallyAllCourseCompletions()
+ *		c - tallyCourseCompletions()
+ *		d - tallyCourseCompletionsByDegree()
+ *		b - tallyJointCourseCompletions()
+ *	e - printPrerequisiteChain()
+ *	g - planStudentGraduation()
+ *	w - showWhatIfCompleted()
+ *	v - tallyAvailableCourses()
+ *	b - auditAllStudents()
+ *	k - rankStudentsByGraduation()
+ *	j - compareStudentAcrossDegrees()
+ *	i - printAuditCacheStats() (found in auditCache)
  *	x - exit
  */
 
@@ -163,6 +176,9 @@ void addCourseToDepartment(CourseBinaryTree* courseTreePtr, DepartmentVector* de
  * Student still neededs to complete in his
  * or her Degree program
  *
+ * courseTreePtr - pointer to the
+ * CourseBinaryTree of every Course
+ *
  * degListPtr - pointer to the DegreeVector
  * we search for the given Student's 
  * Degree program
@@ -172,11 +188,14 @@ void addCourseToDepartment(CourseBinaryTree* courseTreePtr, DepartmentVector* de
  * the Student with name 
  * queryStudentName
  *
+ * auditCachePtr - pointer to the AuditCache
+ * the result is looked up in and kept in
+ *
  * queryStudentName - string name for
  * the Student whose needed Courses we 
  * want to print
  */
-void studentCoursesStillNeeded(DegreeVector* degListPtr, StudentBinaryTree* studentTreePtr, char* queryStudentName);
+void studentCoursesStillNeeded(CourseBinaryTree* courseTreePtr, DegreeVector* degListPtr, StudentBinaryTree* studentTreePtr, AuditCache* auditCachePtr, char* queryStudentName);
 
 /*
  * prints all of the available Courses for a 
@@ -189,6 +208,9 @@ void studentCoursesStillNeeded(DegreeVector* degListPtr, StudentBinaryTree* stud
  * Courses from their Degree program separated
  * by new lines
  *
+ * courseTreePtr - pointer to the
+ * CourseBinaryTree of every Course
+ *
  * degListPtr - pointer to the DegreeVector
  * we search for the given Student's 
  * Degree program
@@ -198,11 +220,14 @@ void studentCoursesStillNeeded(DegreeVector* degListPtr, StudentBinaryTree* stud
  * the Student with name 
  * queryStudentName
  *
+ * auditCachePtr - pointer to the AuditCache
+ * the result is looked up in and kept in
+ *
  * queryStudentName - string name for
  * the Student whose available Coruses
  * we want to print
  */
-void showAvailableCoursesForStudent(DegreeVector* degListPtr, StudentBinaryTree* studentTreePtr, char* queryStudentName);
+void showAvailableCoursesForStudent(CourseBinaryTree* courseTreePtr, DegreeVector* degListPtr, StudentBinaryTree* studentTreePtr, AuditCache* auditCachePtr, char* queryStudentName);
 
 /*
  * removes a Course with the given Course name
@@ -225,30 +250,263 @@ void showAvailableCoursesForStudent(DegreeVector* degListPtr, StudentBinaryTree*
 void removeCourseFromDegree(DegreeVector* degListPtr, char** userInputArray);
 
 /*
- * clears a given Course of all of its information 
- * and removes it from all Departments, Degrees, 
- * Students, and the main CourseBinaryTree
+ * clears each given Course of all of its 
+ * information and removes it from all 
+ * Departments, Degrees, Students, and the 
+ * main CourseBinaryTree - each Department,
+ * Degree, and Student is compacted once for
+ * all of the Courses
  *
  * prints every updated Department, Degree, and 
  * Student to the terminal
  *
  * courseTreePtr - pointer to the CourseBinaryTree
- * we want to search and remove a Course from
+ * we want to search and remove Courses from
  *
  * depListPtr - pointer to the DepartmentVector
- * we want to search and remove a Course from
+ * we want to search and remove Courses from
  *
  * degListPtr - pointer to the DegreeVector 
- * we want to search and remove a Course from
+ * we want to search and remove Courses from
  *
  * studentTreePtr - pointer to the 
- * StudentBinaryTree we want to remove a 
- * Course from
+ * StudentBinaryTree we want to remove 
+ * Courses from
  *
  * userInputArray - array of strings needed
- * to perform this function, including the
- * Department name and Course name
+ * to perform this function - the Department 
+ * name followed by one or more Course names
+ *
+ * numStrings - number of strings in 
+ * userInputArray
+ */
+void removeCoursesFromAll(CourseBinaryTree* courseTreePtr, DepartmentVector* depListPtr, DegreeVector* degListPtr, StudentBinaryTree* studentTreePtr, char** userInputArray, int numStrings);
+
+/*
+ * prints the number of Students who have
+ * completed each Course on the CourseBinaryTree,
+ * in alphabetical order
+ *
+ * courseTreePtr - pointer to the CourseBinaryTree
+ * whose Courses we print
+ *
+ * storePtr - pointer to the (refreshed)
+ * CompletionStore we count completions with
+ */
+void tallyAllCourseCompletions(CourseBinaryTree* courseTreePtr, CompletionStore* storePtr);
+
+/*
+ * prints the number and share of Students who
+ * have completed the Course with the given
+ * Course name
+ *
+ * courseTreePtr - pointer to the CourseBinaryTree
+ * we search for the Course
+ *
+ * storePtr - pointer to the (refreshed)
+ * CompletionStore we count completions with
+ *
+ * queryCourseName - string name of the Course
+ */
+void tallyCourseCompletions(CourseBinaryTree* courseTreePtr, CompletionStore* storePtr, char* queryCourseName);
+
+/*
+ * prints, for every Degree program held by a
+ * Student, the number and share of its Students
+ * who have completed the Course with the given
+ * Course name
+ *
+ * courseTreePtr - pointer to the CourseBinaryTree
+ * we search for the Course
+ *
+ * storePtr - pointer to the (refreshed)
+ * CompletionStore we count completions with
+ *
+ * queryCourseName - string name of the Course
+ */
+void tallyCourseCompletionsByDegree(CourseBinaryTree* courseTreePtr, CompletionStore* storePtr, char* queryCourseName);
+
+/*
+ * prints the number of Students who have
+ * completed both of the two given Courses
+ *
+ * courseTreePtr - pointer to the CourseBinaryTree
+ * we search for the Courses
+ *
+ * storePtr - pointer to the (refreshed)
+ * CompletionStore we count completions with
+ *
+ * userInputArray - the string array containing
+ * the two Course names
+ *
+ * numStrings - the number of strings in
+ * userInputArray
+ */
+void tallyJointCourseCompletions(CourseBinaryTree* courseTreePtr, CompletionStore* storePtr, char** userInputArray, int numStrings);
+
+/*
+ * prints every transitive prerequisite of a
+ * Course - its prerequisites, their
+ * prerequisites, and so on - each after its
+ * own prerequisites, or, for a Student, only
+ * those the Student has not completed
+ *
+ * courseTreePtr - pointer to the CourseBinaryTree
+ * we search for the Course
+ *
+ * studentTreePtr - pointer to the
+ * StudentBinaryTree we search for the Student
+ *
+ * userInputArray - the string array containing
+ * the Course name and, optionally, the Student
+ * name
+ *
+ * numStrings - the number of strings in
+ * userInputArray
+ */
+void printPrerequisiteChain(CourseBinaryTree* courseTreePtr, StudentBinaryTree* studentTreePtr, char** userInputArray, int numStrings);
+
+/*
+ * prints a term-by-term plan of the Courses a
+ * Student still needs for his or her Degree
+ * program, with prerequisites in earlier terms
+ * and at most the given number of Courses in
+ * each term
+ *
+ * courseTreePtr - pointer to the CourseBinaryTree
+ * of every Course
+ *
+ * degListPtr - pointer to the DegreeVector we
+ * search for the Student's Degree program
+ *
+ * studentTreePtr - pointer to the
+ * StudentBinaryTree we search for the Student
+ *
+ * userInputArray - the string array containing
+ * the Student name and, optionally, the most
+ * Courses per term
+ *
+ * numStrings - the number of strings in
+ * userInputArray
+ */
+void planStudentGraduation(CourseBinaryTree* courseTreePtr, DegreeVector* degListPtr, StudentBinaryTree* studentTreePtr, char** userInputArray, int numStrings);
+
+/*
+ * prints, for each given Course on its own,
+ * the Courses that would become available and
+ * the Degree Courses that would be left if the
+ * Student completed it, without changing the
+ * Student
+ *
+ * courseTreePtr - pointer to the CourseBinaryTree
+ * of every Course
+ *
+ * degListPtr - pointer to the DegreeVector we
+ * search for the Student's Degree program
+ *
+ * studentTreePtr - pointer to the
+ * StudentBinaryTree we search for the Student
+ *
+ * userInputArray - the string array containing
+ * the Student name and one or more Course names
+ *
+ * numStrings - the number of strings in
+ * userInputArray
+ */
+void showWhatIfCompleted(CourseBinaryTree* courseTreePtr, DegreeVector* degListPtr, StudentBinaryTree* studentTreePtr, char** userInputArray, int numStrings);
+
+/*
+ * prints, for each Degree program held by at
+ * least one Student, how many of its Courses
+ * its Students can take next, evaluated for
+ * every Student at once (and, built with
+ * COMMAND_TIMING, the throughput of the
+ * evaluation)
+ *
+ * courseTreePtr - pointer to the CourseBinaryTree
+ * of every Course
+ *
+ * degListPtr - pointer to the DegreeVector we
+ * search for the Degree programs
+ *
+ * studentTreePtr - pointer to the
+ * StudentBinaryTree of every Student
+ *
+ * storePtr - pointer to the CompletionStore,
+ * refreshed first
+ */
+void tallyAvailableCourses(CourseBinaryTree* courseTreePtr, DegreeVector* degListPtr, StudentBinaryTree* studentTreePtr, CompletionStore* storePtr);
+
+/*
+ * audits every Student, or every Student in
+ * one Degree program, against the Degree's
+ * requirements in parallel and writes a
+ * tab-separated report of each Student's
+ * missing requirement groups to a file
+ *
+ * courseTreePtr - pointer to the CourseBinaryTree
+ * of every Course
+ *
+ * degListPtr - pointer to the DegreeVector we
+ * search for the Degree programs
+ *
+ * studentTreePtr - pointer to the
+ * StudentBinaryTree of every Student
+ *
+ * storePtr - pointer to the CompletionStore,
+ * refreshed first
+ *
+ * userInputArray - the report file name and
+ * optionally a Degree name
+ *
+ * numStrings - the number of strings in
+ * userInputArray
+ */
+void auditAllStudents(CourseBinaryTree* courseTreePtr, DegreeVector* degListPtr, StudentBinaryTree* studentTreePtr, CompletionStore* storePtr, char** userInputArray, int numStrings);
+
+/*
+ * prints the k Students with the fewest
+ * requirement groups left in their Degree
+ * programs, or in one Degree program,
+ * ranked in parallel without keeping an
+ * audit of every Student
+ *
+ * courseTreePtr - pointer to the CourseBinaryTree
+ * of every Course
+ *
+ * degListPtr - pointer to the DegreeVector we
+ * search for the Degree programs
+ *
+ * studentTreePtr - pointer to the
+ * StudentBinaryTree of every Student
+ *
+ * storePtr - pointer to the CompletionStore,
+ * refreshed first
+ *
+ * userInputArray - k and optionally a
+ * Degree name
+ *
+ * numStrings - the number of strings in
+ * userInputArray
+ */
+void rankStudentsByGraduation(CourseBinaryTree* courseTreePtr, DegreeVector* degListPtr, StudentBinaryTree* studentTreePtr, CompletionStore* storePtr, char** userInputArray, int numStrings);
+
+/*
+ * prints how many requirement groups and
+ * Courses a Student would have left in every
+ * Degree program of the DegreeVector, the
+ * closest first, to compare changing
+ * programs without changing the Student
+ *
+ * degListPtr - pointer to the DegreeVector of
+ * every Degree program
+ *
+ * studentTreePtr - pointer to the
+ * StudentBinaryTree we search for the Student
+ *
+ * queryStudentName - string name of the
+ * Student
  */
-void removeCourseFromAll(CourseBinaryTree* courseTreePtr, DepartmentVector* depListPtr, DegreeVector* degListPtr, StudentBinaryTree* studentTreePtr, char** userInputArray);
+void compareStudentAcrossDegrees(DegreeVector* degListPtr, StudentBinaryTree* studentTreePtr, char* queryStudentName);
 
 #endif
@@ -0,0 +1,480 @@
+/*
+ *
+ *	C source file containing the implementation of
+ *	the RequirementGroups ADT and the Degree audit
+ *	that runs over it
+ *
+ *	Go to header file for more information
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "requirementGroups.h"
+
+/*
+ * initRequirementGroups() allocates heap space for
+ * RequirementGroups and for ten groups and ten
+ * Courses, and returns a pointer to the new, empty
+ * RequirementGroups
+ *
+ * the version is left at zero, which no Vector has,
+ * so the first check always flattens the Vector
+ */
+RequirementGroups* initRequirementGroups() {
+
+	// allocating heap space
+	RequirementGroups *groupsPtr = (RequirementGroups*) malloc(sizeof(RequirementGroups));
+	// filling in data members
+	groupsPtr->vectorVersion = 0;
+	groupsPtr->numGroups = 0;
+	groupsPtr->groupCapacity = 10;
+	groupsPtr->groups = (RequirementGroup*) calloc(groupsPtr->groupCapacity, sizeof(RequirementGroup));
+	groupsPtr->numCourses = 0;
+	groupsPtr->courseCapacity = 10;
+	groupsPtr->courseIds = (unsigned int*) calloc(groupsPtr->courseCapacity, sizeof(unsigned int));
+	groupsPtr->courses = (Course**) calloc(groupsPtr->courseCapacity, sizeof(Course*));
+	groupsPtr->numMaskBlocks = 0;
+	groupsPtr->maskBlockIndices = NULL;
+	groupsPtr->maskWords = NULL;
+	groupsPtr->numRequiredBlocks = 0;
+	groupsPtr->requiredBlockIndices = NULL;
+	groupsPtr->requiredWords = NULL;
+	groupsPtr->numRequiredIds = 0;
+	groupsPtr->requiredIds = NULL;
+	groupsPtr->requiredGroups = NULL;
+	groupsPtr->numOtherGroups = 0;
+	groupsPtr->otherGroups = NULL;
+	return groupsPtr;
+}
+
+/*
+ * freeRequirementMasks() takes a RequirementGroups
+ * pointer as an argument and frees the arrays of its
+ * compiled masks
+ */
+void freeRequirementMasks(RequirementGroups *groupsPtr) {
+
+	free(groupsPtr->maskBlockIndices);
+	free(groupsPtr->maskWords);
+	free(groupsPtr->requiredBlockIndices);
+	free(groupsPtr->requiredWords);
+	free(groupsPtr->requiredIds);
+	free(groupsPtr->requiredGroups);
+	free(groupsPtr->otherGroups);
+	return;
+}
+
+/*
+ * freeRequirementGroups() takes a RequirementGroups
+ * pointer as an argument and frees its arrays and
+ * the RequirementGroups themselves
+ */
+void freeRequirementGroups(RequirementGroups *groupsPtr) {
+
+	if (groupsPtr == NULL) {
+		return;
+	}
+	free(groupsPtr->groups);
+	free(groupsPtr->courseIds);
+	free(groupsPtr->courses);
+	freeRequirementMasks(groupsPtr);
+	free(groupsPtr);
+	return;
+}
+
+/*
+ * addRequirementCourse() takes a RequirementGroups
+ * pointer and a Course pointer as arguments and
+ * appends the Course (and its id) to the end of the
+ * Course arrays, doubling their capacity as necessary
+ */
+void addRequirementCourse(RequirementGroups *groupsPtr, Course *coursePtr) {
+
+	if (groupsPtr->numCourses == groupsPtr->courseCapacity) {
+		unsigned int newCapacity = groupsPtr->courseCapacity * 2;
+		groupsPtr->courseIds = (unsigned int*) realloc(groupsPtr->courseIds, newCapacity * sizeof(unsigned int));
+		groupsPtr->courses = (Course**) realloc(groupsPtr->courses, newCapacity * sizeof(Course*));
+		groupsPtr->courseCapacity = newCapacity;
+	}
+	groupsPtr->courseIds[groupsPtr->numCourses] = coursePtr->id;
+	groupsPtr->courses[groupsPtr->numCourses] = coursePtr;
+	groupsPtr->numCourses++;
+	return;
+}
+
+/*
+ * allocateMaskWords() takes a number of mask blocks as
+ * an argument and returns zeroed, block aligned heap
+ * space for them (always room for one block, so
+ * aligned_alloc() is never asked for nothing)
+ */
+uint64_t* allocateMaskWords(unsigned int numBlocks) {
+
+	size_t size = (size_t) (numBlocks + 1) * BITSET_BLOCK_WORDS * sizeof(uint64_t);
+	uint64_t *maskWords = (uint64_t*) aligned_alloc(BITSET_BLOCK_WORDS * sizeof(uint64_t), size);
+	memset(maskWords, 0, size);
+	return maskWords;
+}
+
+/*
+ * addToMask() takes an array of block indices, the
+ * matching mask words, a pointer to the number of
+ * blocks in the mask, and a Course id as arguments
+ *
+ * addToMask() sets the Course id's bit in the mask's
+ * block for it, adding the block at the end if the
+ * mask does not have it yet
+ */
+void addToMask(unsigned int *blockIndices, uint64_t *maskWords, unsigned int *numBlocksPtr, unsigned int courseId) {
+
+	unsigned int blockIndex = courseId / BITSET_BLOCK_BITS;
+	unsigned int block = *numBlocksPtr;
+	// the last block is the likeliest match
+	while (block > 0 && blockIndices[block - 1] != blockIndex) {
+		block--;
+	}
+	if (block == 0) {
+		block = *numBlocksPtr;
+		blockIndices[block] = blockIndex;
+		(*numBlocksPtr)++;
+	} else {
+		block--;
+	}
+	unsigned int bit = courseId % BITSET_BLOCK_BITS;
+	maskWords[(size_t) block * BITSET_BLOCK_WORDS + bit / 64] |= (uint64_t) 1 << (bit % 64);
+	return;
+}
+
+/*
+ * compileRequirementMasks() takes a RequirementGroups
+ * pointer as an argument
+ *
+ * compileRequirementMasks() frees the old masks and
+ * then:
+ *  - sets the bits of each group's Course ids in the
+ *    group's own mask
+ *  - sorts the conjunct groups by Course id, leaving
+ *    out a Course an earlier group already requires,
+ *    and sets their Course ids in the required mask,
+ *    whose blocks are then in increasing order
+ *  - lists every other group
+ * no mask ever has more blocks than there are Courses
+ */
+void compileRequirementMasks(RequirementGroups *groupsPtr) {
+
+	freeRequirementMasks(groupsPtr);
+	unsigned int numCourses = groupsPtr->numCourses;
+	unsigned int numGroups = groupsPtr->numGroups;
+	groupsPtr->maskBlockIndices = (unsigned int*) malloc( (numCourses + 1) * sizeof(unsigned int) );
+	groupsPtr->maskWords = allocateMaskWords(numCourses);
+	groupsPtr->requiredBlockIndices = (unsigned int*) malloc( (numCourses + 1) * sizeof(unsigned int) );
+	groupsPtr->requiredWords = allocateMaskWords(numCourses);
+	groupsPtr->requiredIds = (unsigned int*) malloc( (numGroups + 1) * sizeof(unsigned int) );
+	groupsPtr->requiredGroups = (unsigned int*) malloc( (numGroups + 1) * sizeof(unsigned int) );
+	groupsPtr->otherGroups = (unsigned int*) malloc( (numGroups + 1) * sizeof(unsigned int) );
+
+	// every group's own mask
+	groupsPtr->numMaskBlocks = 0;
+	for (unsigned int i = 0; i < numGroups; i++) {
+		RequirementGroup *groupPtr = groupsPtr->groups + i;
+		groupPtr->maskOffset = groupsPtr->numMaskBlocks;
+		groupPtr->numBlocks = 0;
+		for (unsigned int j = 0; j < groupPtr->count; j++) {
+			addToMask(groupsPtr->maskBlockIndices + groupPtr->maskOffset,
+					groupsPtr->maskWords + (size_t) groupPtr->maskOffset * BITSET_BLOCK_WORDS,
+					&groupPtr->numBlocks, groupsPtr->courseIds[groupPtr->offset + j]);
+		}
+		groupsPtr->numMaskBlocks += groupPtr->numBlocks;
+	}
+
+	// the conjunct groups, in Course id order (ties in
+	// group order, so the first group keeps the Course)
+	unsigned int numConjuncts = 0;
+	groupsPtr->numOtherGroups = 0;
+	for (unsigned int i = 0; i < numGroups; i++) {
+		if (groupsPtr->groups[i].count == 1) {
+			groupsPtr->requiredGroups[numConjuncts] = i;
+			numConjuncts++;
+		} else {
+			groupsPtr->otherGroups[groupsPtr->numOtherGroups] = i;
+			groupsPtr->numOtherGroups++;
+		}
+	}
+	unsigned int *groupCourseIds = (unsigned int*) malloc( (numGroups + 1) * sizeof(unsigned int) );
+	for (unsigned int i = 0; i < numGroups; i++) {
+		groupCourseIds[i] = groupsPtr->courseIds[groupsPtr->groups[i].offset];
+	}
+	for (unsigned int i = 1; i < numConjuncts; i++) {
+		// insertion keeps equal Course ids in group order
+		unsigned int group = groupsPtr->requiredGroups[i];
+		unsigned int j = i;
+		while (j > 0 && groupCourseIds[groupsPtr->requiredGroups[j - 1]] > groupCourseIds[group]) {
+			groupsPtr->requiredGroups[j] = groupsPtr->requiredGroups[j - 1];
+			j--;
+		}
+		groupsPtr->requiredGroups[j] = group;
+	}
+
+	// the required mask
+	groupsPtr->numRequiredBlocks = 0;
+	groupsPtr->numRequiredIds = 0;
+	for (unsigned int i = 0; i < numConjuncts; i++) {
+		unsigned int group = groupsPtr->requiredGroups[i];
+		unsigned int courseId = groupCourseIds[group];
+		if (groupsPtr->numRequiredIds > 0 && groupsPtr->requiredIds[groupsPtr->numRequiredIds - 1] == courseId) {
+			groupsPtr->otherGroups[groupsPtr->numOtherGroups] = group;
+			groupsPtr->numOtherGroups++;
+			continue;
+		}
+		groupsPtr->requiredIds[groupsPtr->numRequiredIds] = courseId;
+		groupsPtr->requiredGroups[groupsPtr->numRequiredIds] = group;
+		groupsPtr->numRequiredIds++;
+		addToMask(groupsPtr->requiredBlockIndices, groupsPtr->requiredWords, &groupsPtr->numRequiredBlocks, courseId);
+	}
+	free(groupCourseIds);
+	return;
+}
+
+/*
+ * flattenRequirements() takes a RequirementGroups
+ * pointer and a Vector pointer as arguments
+ *
+ * flattenRequirements() empties the RequirementGroups
+ * and then, for every Element of the Vector, appends
+ * the Element's Course and each of its disjunct
+ * Courses to the Course arrays and records where
+ * they start and how many there are as one group -
+ * the masks of the groups are compiled last
+ *
+ * the Vector's version is recorded so that callers
+ * can tell when the groups are out of date
+ */
+void flattenRequirements(RequirementGroups *groupsPtr, Vector *vectorPtr) {
+
+	// checking for NULL pointer arguments
+	if (groupsPtr == NULL) {
+		printf("\nCannot flatten requirements "
+				"with NULL RequirementGroups "
+				"pointer argument\n");
+		return;
+	}
+	if (vectorPtr == NULL) {
+		printf("\nCannot flatten requirements "
+				"with NULL Vector pointer "
+				"argument\n");
+		return;
+	}
+
+	groupsPtr->numGroups = 0;
+	groupsPtr->numCourses = 0;
+	// making room for one group per Element
+	if (vectorPtr->numElements > groupsPtr->groupCapacity) {
+		groupsPtr->groupCapacity = vectorPtr->numElements;
+		groupsPtr->groups = (RequirementGroup*) realloc(groupsPtr->groups, groupsPtr->groupCapacity * sizeof(RequirementGroup));
+	}
+
+	// one group per Element - the Element's Course
+	// followed by all of its disjunct Courses
+	for (unsigned int i = 0; i < vectorPtr->numElements; i++) {
+		RequirementGroup *groupPtr = groupsPtr->groups + i;
+		groupPtr->offset = groupsPtr->numCourses;
+		Element *elementPtr = vectorPtr->elements + i;
+		while (elementPtr != NULL) {
+			addRequirementCourse(groupsPtr, elementPtr->course);
+			elementPtr = elementPtr->disjunct;
+		}
+		groupPtr->count = groupsPtr->numCourses - groupPtr->offset;
+	}
+	groupsPtr->numGroups = vectorPtr->numElements;
+	compileRequirementMasks(groupsPtr);
+	groupsPtr->vectorVersion = vectorPtr->version;
+	return;
+}
+
+/*
+ * isRequirementFulfilled() takes a RequirementGroups
+ * pointer, the index of a group, and a BitSet pointer
+ * of completed Course ids as arguments
+ *
+ * isRequirementFulfilled() tests each block of the
+ * group's mask against the BitSet block it stands for
+ */
+bool isRequirementFulfilled(RequirementGroups *groupsPtr, unsigned int groupIndex, BitSet *completedPtr) {
+
+	if (groupsPtr == NULL || completedPtr == NULL || groupIndex >= groupsPtr->numGroups) {
+		return false;
+	}
+
+	RequirementGroup *groupPtr = groupsPtr->groups + groupIndex;
+	return intersectsBlocks(completedPtr,
+			groupsPtr->maskBlockIndices + groupPtr->maskOffset,
+			groupsPtr->maskWords + (size_t) groupPtr->maskOffset * BITSET_BLOCK_WORDS,
+			groupPtr->numBlocks);
+}
+
+/*
+ * findUnfulfilledGroups() takes a RequirementGroups
+ * pointer, a BitSet pointer of completed Course ids,
+ * and an array with room for every group's index as
+ * arguments
+ *
+ * findUnfulfilledGroups() goes through the required
+ * mask one word at a time, looking up the group of
+ * each bit that is not completed - the bits and the
+ * Course ids are both in increasing order, so the
+ * lookup only moves forward - and tests every other
+ * group's own mask
+ *
+ * the array is first used as one flag per group, and
+ * the flagged groups are then moved to its front, so
+ * they come out in group order without sorting
+ *
+ * returns the number of unfulfilled groups
+ */
+unsigned int findUnfulfilledGroups(RequirementGroups *groupsPtr, BitSet *completedPtr, unsigned int *missingGroups) {
+
+	// checking for NULL pointer arguments
+	if (groupsPtr == NULL || completedPtr == NULL || missingGroups == NULL) {
+		printf("\nCannot find unfulfilled requirements "
+				"with NULL RequirementGroups, "
+				"BitSet, or array pointer "
+				"argument\n");
+		return 0;
+	}
+
+	memset(missingGroups, 0, groupsPtr->numGroups * sizeof(unsigned int));
+	unsigned int requiredIndex = 0;
+	for (unsigned int i = 0; i < groupsPtr->numRequiredBlocks; i++) {
+		unsigned int firstWord = groupsPtr->requiredBlockIndices[i] * BITSET_BLOCK_WORDS;
+		for (unsigned int w = 0; w < BITSET_BLOCK_WORDS; w++) {
+			unsigned int word = firstWord + w;
+			uint64_t completedWord = (word < completedPtr->numWords) ? completedPtr->words[word] : 0;
+			uint64_t missingWord = groupsPtr->requiredWords[(size_t) i * BITSET_BLOCK_WORDS + w] & ~completedWord;
+			while (missingWord != 0) {
+				unsigned int courseId = word * 64 + __builtin_ctzll(missingWord);
+				while (groupsPtr->requiredIds[requiredIndex] != courseId) {
+					requiredIndex++;
+				}
+				missingGroups[groupsPtr->requiredGroups[requiredIndex]] = 1;
+				missingWord &= missingWord - 1;
+			}
+		}
+	}
+	for (unsigned int i = 0; i < groupsPtr->numOtherGroups; i++) {
+		if ( !isRequirementFulfilled(groupsPtr, groupsPtr->otherGroups[i], completedPtr) ) {
+			missingGroups[groupsPtr->otherGroups[i]] = 1;
+		}
+	}
+
+	// never more groups before a flag than its index
+	unsigned int numMissing = 0;
+	for (unsigned int i = 0; i < groupsPtr->numGroups; i++) {
+		if (missingGroups[i]) {
+			missingGroups[numMissing] = i;
+			numMissing++;
+		}
+	}
+	return numMissing;
+}
+
+/*
+ * countUnfulfilledGroups() takes a RequirementGroups
+ * pointer and a BitSet pointer of completed Course ids
+ * as arguments
+ *
+ * countUnfulfilledGroups() counts the bits of the
+ * required mask that are not completed - one for each
+ * conjunct group - and adds every other group that is
+ * not fulfilled
+ *
+ * returns the number of unfulfilled groups
+ */
+unsigned int countUnfulfilledGroups(RequirementGroups *groupsPtr, BitSet *completedPtr) {
+
+	// checking for NULL pointer arguments
+	if (groupsPtr == NULL || completedPtr == NULL) {
+		printf("\nCannot count unfulfilled requirements "
+				"with NULL RequirementGroups or "
+				"BitSet pointer argument\n");
+		return 0;
+	}
+
+	unsigned int numUnfulfilled = countMissingBlocks(completedPtr, groupsPtr->requiredBlockIndices, groupsPtr->requiredWords, groupsPtr->numRequiredBlocks);
+	for (unsigned int i = 0; i < groupsPtr->numOtherGroups; i++) {
+		numUnfulfilled += !isRequirementFulfilled(groupsPtr, groupsPtr->otherGroups[i], completedPtr);
+	}
+	return numUnfulfilled;
+}
+
+/*
+ * countMissingRequirements() takes a RequirementGroups
+ * pointer and a BitSet pointer of completed Course ids
+ * as arguments
+ *
+ * countMissingRequirements() counts the bits of the
+ * required mask that are not completed - one Course
+ * for each conjunct group - and adds the Course count
+ * of every other group that is not fulfilled
+ *
+ * returns the number of missing Courses and -1 for
+ * error
+ */
+int countMissingRequirements(RequirementGroups *groupsPtr, BitSet *completedPtr) {
+
+	// checking for NULL pointer arguments
+	if (groupsPtr == NULL || completedPtr == NULL) {
+		printf("\nCannot count missing requirements "
+				"with NULL RequirementGroups or "
+				"BitSet pointer argument\n");
+		return -1;
+	}
+
+	int numMissing = (int) countMissingBlocks(completedPtr, groupsPtr->requiredBlockIndices, groupsPtr->requiredWords, groupsPtr->numRequiredBlocks);
+	for (unsigned int i = 0; i < groupsPtr->numOtherGroups; i++) {
+		unsigned int group = groupsPtr->otherGroups[i];
+		if ( !isRequirementFulfilled(groupsPtr, group, completedPtr) ) {
+			numMissing += groupsPtr->groups[group].count;
+		}
+	}
+	return numMissing;
+}
+
+/*
+ * countFulfilledIfCompleted() takes a RequirementGroups
+ * pointer, a BitSet pointer of completed Course ids,
+ * and a Course id as arguments
+ *
+ * countFulfilledIfCompleted() adds up the Course count
+ * of every group that is not fulfilled and has the
+ * Course - only those groups change when it is
+ * completed
+ *
+ * returns the number of Courses and -1 for error
+ */
+int countFulfilledIfCompleted(RequirementGroups *groupsPtr, BitSet *completedPtr, unsigned int courseId) {
+
+	// checking for NULL pointer arguments
+	if (groupsPtr == NULL || completedPtr == NULL) {
+		printf("\nCannot count fulfilled requirements "
+				"with NULL RequirementGroups or "
+				"BitSet pointer argument\n");
+		return -1;
+	}
+
+	int numFulfilled = 0;
+	for (unsigned int i = 0; i < groupsPtr->numGroups; i++) {
+		RequirementGroup group = groupsPtr->groups[i];
+		unsigned int *courseIds = groupsPtr->courseIds + group.offset;
+		for (unsigned int j = 0; j < group.count; j++) {
+			if (courseIds[j] == courseId) {
+				if ( !isRequirementFulfilled(groupsPtr, i, completedPtr) ) {
+					numFulfilled += group.count;
+				}
+				break;
+			}
+		}
+	}
+	return numFulfilled;
+}
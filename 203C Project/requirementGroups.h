@@ -0,0 +1,200 @@
+/*
+ *
+ *	Header file for the RequirementGroups ADT interface
+ *
+ *	RequirementGroups is a flat copy of a Degree's
+ *	Vector of required Courses, built for auditing
+ *	Students against the Degree.
+ *
+ *	Each Element of the Degree's Vector becomes one
+ *	requirement group: an (offset, count) pair into a
+ *	single contiguous array of Course ids. The first
+ *	Course of the group is the Vector Element's Course
+ *	and the rest are its disjunct Courses, in order.
+ *	A group with a count of one is a conjunct
+ *	requirement, and a group with a larger count is
+ *	fulfilled by any one of its Courses.
+ *
+ *	The groups are also compiled into masks over Course
+ *	ids, made of the blocks of a BitSet (see bitSet.h)
+ *	that hold at least one of their Course ids, each
+ *	with the index of its block:
+ *	 - the required mask has the Course of every
+ *	   conjunct group, so all of them are checked
+ *	   against a Student's completed Courses with one
+ *	   vector AND NOT and population count per block
+ *	 - every group also has a mask of its own, which
+ *	   is fulfilled if it intersects the completed
+ *	   Courses - one vector AND and one test for
+ *	   nonzero per block, a single block unless the
+ *	   group's Courses are far apart
+ *	So no disjunct list is followed and no Course name
+ *	is compared. The masks of all groups share one
+ *	block aligned array of words. The Course ids, and a
+ *	matching array of Course pointers, are kept next to
+ *	the masks so results can be printed or turned back
+ *	into Vectors (see courseSet.h).
+ *
+ *	RequirementGroups remember the version of the
+ *	Vector they were built from (see Vector in
+ *	coursePtrVector.h) so they can be rebuilt when
+ *	the Degree's requirements change - the masks are
+ *	compiled again with the groups.
+ *
+ */
+
+#ifndef REQUIREMENTGROUPS_H
+#define REQUIREMENTGROUPS_H
+
+#include "coursePtrVector.h"
+#include "bitSet.h"
+
+// struct for one requirement group - count Courses
+// starting at offset in the Course id array, and
+// numBlocks mask blocks starting at maskOffset in the
+// mask block indices (and at maskOffset blocks into
+// the mask words)
+typedef struct requirementGroup {
+	unsigned int offset;
+	unsigned int count;
+	unsigned int maskOffset;
+	unsigned int numBlocks;
+} RequirementGroup;
+
+// struct for a flattened Vector of requirements
+typedef struct requirementGroups {
+	unsigned int vectorVersion;
+	unsigned int numGroups;
+	unsigned int groupCapacity;
+	RequirementGroup *groups;
+	unsigned int numCourses;
+	unsigned int courseCapacity;
+	unsigned int *courseIds;
+	Course **courses;
+	// every group's mask blocks
+	unsigned int numMaskBlocks;
+	unsigned int *maskBlockIndices;
+	uint64_t *maskWords;
+	// the required mask of conjunct groups, and the
+	// group of each of its Course ids, in id order
+	unsigned int numRequiredBlocks;
+	unsigned int *requiredBlockIndices;
+	uint64_t *requiredWords;
+	unsigned int numRequiredIds;
+	unsigned int *requiredIds;
+	unsigned int *requiredGroups;
+	// groups not in the required mask - disjunct
+	// groups, and a conjunct group whose Course an
+	// earlier group already requires
+	unsigned int numOtherGroups;
+	unsigned int *otherGroups;
+} RequirementGroups;
+
+
+// RequirementGroups interface
+
+/*
+ * allocates heap space for empty
+ * RequirementGroups and returns a
+ * pointer to them
+ */
+RequirementGroups* initRequirementGroups();
+
+/*
+ * frees RequirementGroups and their
+ * group and Course arrays
+ *
+ * groupsPtr - pointer to the
+ * RequirementGroups to free
+ */
+void freeRequirementGroups(RequirementGroups* groupsPtr);
+
+/*
+ * (re)builds the RequirementGroups from a
+ * Vector of Elements, one group per Element,
+ * compiles the masks, and records the
+ * Vector's version
+ *
+ * groupsPtr - pointer to the RequirementGroups
+ * to fill
+ *
+ * vectorPtr - pointer to the Vector of
+ * required Courses to flatten
+ */
+void flattenRequirements(RequirementGroups* groupsPtr, Vector* vectorPtr);
+
+/*
+ * returns true if at least one Course of the
+ * requirement group is set in the BitSet of
+ * completed Course ids - the group's mask
+ * intersects the BitSet
+ *
+ * groupsPtr - pointer to the RequirementGroups
+ *
+ * groupIndex - index of the group to check
+ *
+ * completedPtr - pointer to the BitSet of
+ * completed Course ids
+ */
+bool isRequirementFulfilled(RequirementGroups* groupsPtr, unsigned int groupIndex, BitSet* completedPtr);
+
+/*
+ * fills an array with the index of every
+ * requirement group that is not fulfilled by
+ * the BitSet of completed Course ids, in group
+ * order, and returns how many there are
+ *
+ * groupsPtr - pointer to the RequirementGroups
+ *
+ * completedPtr - pointer to the BitSet of
+ * completed Course ids
+ *
+ * missingGroups - array with room for every
+ * group's index
+ */
+unsigned int findUnfulfilledGroups(RequirementGroups* groupsPtr, BitSet* completedPtr, unsigned int* missingGroups);
+
+/*
+ * returns the number of requirement groups
+ * that are not fulfilled by the BitSet of
+ * completed Course ids
+ *
+ * groupsPtr - pointer to the RequirementGroups
+ *
+ * completedPtr - pointer to the BitSet of
+ * completed Course ids
+ */
+unsigned int countUnfulfilledGroups(RequirementGroups* groupsPtr, BitSet* completedPtr);
+
+/*
+ * returns the number of Courses in the
+ * requirement groups that are not fulfilled
+ * by the BitSet of completed Course ids -
+ * every Course of an unfulfilled disjunct
+ * group is counted, as each is listed by
+ * requirementDifference()
+ *
+ * groupsPtr - pointer to the RequirementGroups
+ *
+ * completedPtr - pointer to the BitSet of
+ * completed Course ids
+ */
+int countMissingRequirements(RequirementGroups* groupsPtr, BitSet* completedPtr);
+
+/*
+ * returns the number of Courses that
+ * countMissingRequirements() would no longer
+ * count if the given Course were completed -
+ * every Course of each unfulfilled group that
+ * has the Course
+ *
+ * groupsPtr - pointer to the RequirementGroups
+ *
+ * completedPtr - pointer to the BitSet of
+ * completed Course ids
+ *
+ * courseId - id of the Course
+ */
+int countFulfilledIfCompleted(RequirementGroups* groupsPtr, BitSet* completedPtr, unsigned int courseId);
+
+#endif
@@ -105,11 +105,16 @@ void allocHeapForStrArr(char ***strArrPtr, char *strArrBuffer[], int numStrings)
  * splitStringAtComma() splits the input string at all
  * commas
  *
- * splitStringAtComma() loads all split strings into a
+ * splitStringAtComma() loads each split string, which
+ * stays in place in the input string, into a
  * string buffer and passes the buffer into a function
  * to load all of the split strings into strictly 
  * allocated heap space (no more or less than needed)
  *
+ * the split strings are not pooled (see stringPool.h) -
+ * a caller that keeps one in a record pools it there,
+ * so looking names up does not grow the pool
+ *
  * splitStringAtComma() returns the number of strings
  * split and loaded
  */
@@ -139,9 +144,6 @@ int splitStringAtComma(char *inputStr, char ***strArrPtr) {
 		delimiter = ",";
 	}
 	strArrBuffer[0] = strtok(inputStr, delimiter);
-	if (strArrBuffer[0] != NULL) {
-		strArrBuffer[0] = strdup(strArrBuffer[0]);
-	}
 	// setting delimiter if first string was "OR"
 	delimiter = ",";
 
@@ -152,9 +154,7 @@ int splitStringAtComma(char *inputStr, char ***strArrPtr) {
 		if (strArrBuffer[i] != NULL) {
 			// + 1 for moving char pointer after whitespace
 			if (strArrBuffer[i][0] == ' ') {
-				strArrBuffer[i] = strdup(strArrBuffer[i]) + 1;
-			} else {
-				strArrBuffer[i] = strdup(strArrBuffer[i]);
+				strArrBuffer[i]++;
 			}
 		}
 	}
@@ -18,6 +18,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "stringLinkedList.h"
+#include "stringPool.h"
 
 /*
  * initListNode() takes a C string, or array of char as
@@ -27,7 +28,8 @@
  * in heap space
  * 
  * initListNode() initializes linked list node with
- * a string as data and initializes its prev and
+ * the pooled copy of the string as data (see
+ * stringPool.h) and initializes its prev and
  * next LinkedListNode pointers with NULL
  *
  * initListNode() returns a pointer to the new
@@ -46,7 +48,7 @@ LinkedListNode* initListNode(char* string) {
 	// allocating heap space	
 	LinkedListNode *nodePtr = (LinkedListNode*) malloc(sizeof(LinkedListNode));
 	// filling in data members
-	nodePtr->name = string;
+	nodePtr->name = internString(string);
 	nodePtr->next = NULL;
 	nodePtr->prev = NULL;
 	return nodePtr;
@@ -119,6 +121,11 @@ void clearLinkedList(LinkedListNode **listPtr) {
  * removeFromLinkedList() removes every LinkedListNode 
  * with listString as its name data member and relinks
  * other LinkedListNodes accordingly
+ *
+ * every LinkedListNode's name is pooled (see
+ * initListNode()), so the names are compared by pointer
+ * with the pooled copy of listString - if it has none,
+ * no LinkedListNode has the name
  */
 void removeFromLinkedList(LinkedListNode **listPtr, char *listString) {
 
@@ -136,6 +143,12 @@ void removeFromLinkedList(LinkedListNode **listPtr, char *listString) {
 		return;
 	}
 
+	// nothing to remove from an empty list
+	if (*listPtr == NULL) {
+		return;
+	}
+
+	char *pooledString = findInternedString(listString);
 	LinkedListNode *currNodePtr = *listPtr;
 	LinkedListNode *nextNodePtr = NULL;
 	int listCounter = 0;
@@ -144,7 +157,7 @@ void removeFromLinkedList(LinkedListNode **listPtr, char *listString) {
 		listCounter++;
 		nextNodePtr = currNodePtr->next;
 		// if listString matches, removing currNodePtr
-		if ( strcmp(currNodePtr->name, listString) == 0 ) {
+		if (currNodePtr->name == pooledString) {
 			if (currNodePtr == *listPtr) {
 				*listPtr = nextNodePtr;
 			}
@@ -0,0 +1,134 @@
+/*
+ *
+ *	C source file containing the implementation of
+ *	the string pool
+ *
+ *	Go to header file for more information
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stringPool.h"
+#include "nameIndex.h"
+
+// pooled strings a new pool has room for
+#define STRING_POOL_INITIAL_CAPACITY 64
+
+// the pool - poolIndex holds the position of each
+// pooled string in poolStrings
+static NameIndex *poolIndex = NULL;
+static char **poolStrings = NULL;
+static unsigned int numPoolStrings = 0;
+static unsigned int poolCapacity = 0;
+
+/*
+ * addToStringPool() takes a heap string that is not
+ * pooled yet as an argument, puts it in the pool (making
+ * the pool first, or making room in it, if needed), and
+ * returns it
+ */
+char* addToStringPool(char *heapString) {
+
+	if (poolIndex == NULL) {
+		poolIndex = initNameIndex();
+		poolCapacity = STRING_POOL_INITIAL_CAPACITY;
+		poolStrings = (char**) malloc(poolCapacity * sizeof(char*));
+	}
+	if (numPoolStrings == poolCapacity) {
+		poolCapacity *= 2;
+		poolStrings = (char**) realloc(poolStrings, poolCapacity * sizeof(char*));
+	}
+	poolStrings[numPoolStrings] = heapString;
+	addToNameIndex(poolIndex, heapString, numPoolStrings);
+	numPoolStrings++;
+	return heapString;
+}
+
+/*
+ * findInternedString() takes a string as an argument and
+ * returns the pooled string equal to it, or NULL if there
+ * is none
+ *
+ * a pooled string is found by its pointer before any
+ * characters are compared (see findInNameIndex())
+ */
+char* findInternedString(char *string) {
+
+	if (string == NULL) {
+		return NULL;
+	}
+	unsigned int position = findInNameIndex(poolIndex, string);
+	return (position == NAME_NOT_INDEXED) ? NULL : poolStrings[position];
+}
+
+/*
+ * internString() takes a string as an argument and
+ * returns the pooled string equal to it, pooling a heap
+ * copy of the string if there is none
+ *
+ * returns NULL for error
+ */
+char* internString(char *string) {
+
+	// checking for NULL pointer argument
+	if (string == NULL) {
+		printf("\nCannot pool a string with no "
+				"string argument\n");
+		return NULL;
+	}
+
+	char *pooledString = findInternedString(string);
+	if (pooledString != NULL) {
+		return pooledString;
+	}
+	return addToStringPool( strdup(string) );
+}
+
+/*
+ * internHeapString() takes a heap string as an argument
+ * and returns the pooled string equal to it - the heap
+ * string itself if there was none, since it is pooled
+ * as it is, and otherwise the pooled one, freeing the
+ * heap string
+ *
+ * returns NULL for error
+ */
+char* internHeapString(char *heapString) {
+
+	// checking for NULL pointer argument
+	if (heapString == NULL) {
+		printf("\nCannot pool a heap string with no "
+				"string argument\n");
+		return NULL;
+	}
+
+	char *pooledString = findInternedString(heapString);
+	if (pooledString == NULL) {
+		return addToStringPool(heapString);
+	}
+	if (pooledString != heapString) {
+		free(heapString);
+	}
+	return pooledString;
+}
+
+/*
+ * freeStringPool() frees every pooled string, the
+ * pool's NameIndex, and its array, leaving an empty
+ * pool behind
+ */
+void freeStringPool() {
+
+	for (unsigned int i = 0; i < numPoolStrings; i++) {
+		free(poolStrings[i]);
+	}
+	free(poolStrings);
+	freeNameIndex(poolIndex);
+	poolIndex = NULL;
+	poolStrings = NULL;
+	numPoolStrings = 0;
+	poolCapacity = 0;
+	return;
+}
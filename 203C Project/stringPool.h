@@ -0,0 +1,74 @@
+/*
+ *
+ *	Header file for the string pool interface
+ *
+ *	The string pool keeps one copy of every distinct name
+ *	the program holds - Course names, Department and
+ *	Degree names, prerequisite strings, and the Degree
+ *	names on Students and Courses - so that every holder
+ *	of a name points at the same canonical string. Two
+ *	pooled names are then equal exactly when their
+ *	pointers are, and the lookups that go through many
+ *	names (see findCoursePtrInVector(),
+ *	checkCourseForPrerequisite(), and
+ *	removeFromLinkedList()) canonicalize the name they
+ *	look for once and compare pointers after that.
+ *
+ *	Names are only pooled where a record keeps them. A
+ *	name that is only looked up (such as a command
+ *	argument) goes through findInternedString() - if it
+ *	is not pooled, no record has it - so lookups never
+ *	grow the pool.
+ *
+ *	The pool is one table for the whole program, built
+ *	on a NameIndex (see nameIndex.h) of the pooled
+ *	strings. A pooled string is never changed or freed
+ *	until freeStringPool(), so holders may keep it for as
+ *	long as they like.
+ *
+ *	Strings are only pooled on the main thread - the
+ *	audit threads only read names that are already
+ *	pooled.
+ *
+ */
+
+#ifndef STRINGPOOL_H
+#define STRINGPOOL_H
+
+
+// string pool interface
+
+/*
+ * returns the pooled copy of a string,
+ * pooling a heap copy of it first if it is
+ * not pooled yet
+ *
+ * string - string to pool
+ */
+char* internString(char* string);
+
+/*
+ * returns the pooled copy of a heap string,
+ * pooling the heap string itself if it is
+ * not pooled yet and freeing it otherwise
+ *
+ * heapString - heap string to pool, which
+ * belongs to the pool afterwards
+ */
+char* internHeapString(char* heapString);
+
+/*
+ * returns the pooled copy of a string, or
+ * NULL if it is not pooled - no pooled
+ * name is equal to it then
+ *
+ * string - string to find
+ */
+char* findInternedString(char* string);
+
+/*
+ * frees every pooled string and the pool
+ */
+void freeStringPool();
+
+#endif
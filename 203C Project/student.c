@@ -26,6 +26,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "student.h"
+#include "stringPool.h"
 
 /*
  * initStudent() takes a C string as
@@ -40,7 +41,9 @@
  * Student's Degree program with NULL
  * and initializes its completedCourses
  * data member with a pointer to the 
- * Student's (currently) empty Vector
+ * Student's (currently) empty sorted Vector,
+ * which is placed right after the Student 
+ * in the same allocation
  *
  * initStudent() returns a pointer to
  * the new Student adn returns NULL if
@@ -55,14 +58,44 @@ Student* initStudent(char* stuName) {
 		return NULL;
 	}
 
-	// allocating memory and initializing Student
-	Student *studentPtr = (Student*) malloc(sizeof(Student));
+	// allocating memory for the Student and its sorted
+	// Vector together and initializing Student
+	Student *studentPtr = (Student*) malloc( sizeof(Student) + vectorSize(STUDENT_INLINE_COURSES, true) );
 	studentPtr->name = stuName;
 	studentPtr->degree = NULL;
-	studentPtr->completedCourses = initVector();
+	studentPtr->degreePtr = NULL;
+	studentPtr->degreeVersion = 0;
+	studentPtr->completedCourses = placeVector(studentPtr + 1, STUDENT_INLINE_COURSES, true);
+	studentPtr->completedSet = NULL;
+	studentPtr->completedSetVersion = 0;
+	studentPtr->availability = NULL;
+	studentPtr->availabilityVersion = 0;
 	return studentPtr;
 }
 
+/*
+ * freeStudent() takes a Student pointer as an argument
+ *
+ * freeStudent() releases the Student's completedCourses
+ * Vector (its storage is part of the Student's own
+ * allocation, so only what it spilled to the heap is
+ * freed), frees its completed Course id BitSet and its
+ * Availability, and then frees the Student
+ *
+ * the Student's name and pooled Degree name are not freed
+ */
+void freeStudent(Student *studentPtr) {
+
+	if (studentPtr == NULL) {
+		return;
+	}
+	releaseVector(studentPtr->completedCourses);
+	freeBitSet(studentPtr->completedSet);
+	freeAvailability(studentPtr->availability);
+	free(studentPtr);
+	return;
+}
+
 /*
  * setStudentDegree() takes a Student pointer
  * and a C string as arguments
@@ -70,6 +103,10 @@ Student* initStudent(char* stuName) {
  * setStudentDegree() simply accesses the
  * given Student's Degree data member and 
  * changes its value with the C string argument
+ *
+ * the Student's resolved Degree pointer is
+ * cleared so that it is looked up again by
+ * getStudentDegree()
  */
 void setStudentDegree(Student* studentPtr, char* degreeName) {
 
@@ -86,19 +123,124 @@ void setStudentDegree(Student* studentPtr, char* degreeName) {
 				"argument\n", degreeName);
 		return;
 	}
-	studentPtr->degree = degreeName;
+	studentPtr->degree = internString(degreeName);
+	studentPtr->degreePtr = NULL;
+	studentPtr->degreeVersion = 0;
 	return;
 }
 
+/*
+ * getStudentDegree() takes a Student pointer and
+ * a DegreeVector pointer as arguments
+ *
+ * a Degree, once found, never moves in the DegreeVector
+ * and the first Degree with a name is always the one
+ * found, so a stored Degree pointer is returned without
+ * a search
+ *
+ * if no Degree was found and the Student's
+ * degreeVersion matches the DegreeVector's version, no
+ * Degree has been added since, so NULL is returned
+ * without a search
+ *
+ * otherwise, getStudentDegree() searches the
+ * DegreeVector with findInDegreeVector() and stores
+ * the result (even NULL) along with the DegreeVector's
+ * current version
+ *
+ * getStudentDegree() returns NULL if the Student's
+ * Degree is not in the DegreeVector and for errors
+ */
+Degree* getStudentDegree(Student *studentPtr, DegreeVector *degListPtr) {
+
+	// checking for NULL pointer arguments
+	if (studentPtr == NULL) {
+		printf("\nCannot get a Student's Degree with "
+				"NULL Student pointer "
+				"argument\n");
+		return NULL;
+	}
+	if (degListPtr == NULL) {
+		printf("\nCannot get %s's Degree with NULL "
+				"DegreeVector pointer "
+				"argument\n", studentPtr->name);
+		return NULL;
+	}
+	if (studentPtr->degree == NULL) {
+		return NULL;
+	}
+
+	// resolving (again) if the Degree was not found
+	// before the DegreeVector last changed
+	if (studentPtr->degreePtr == NULL && studentPtr->degreeVersion != degListPtr->version) {
+		studentPtr->degreePtr = findInDegreeVector(degListPtr, studentPtr->degree);
+		studentPtr->degreeVersion = degListPtr->version;
+	}
+	return studentPtr->degreePtr;
+}
+
+/*
+ * getStudentCompletedSet() takes a Student pointer as
+ * an argument
+ *
+ * if the Student's completedSetVersion matches the
+ * version of the Student's completed Courses, the
+ * stored BitSet is returned as it is
+ *
+ * otherwise, the BitSet is cleared (allocated the
+ * first time) and the id of every completed Course 
+ * is set in it
+ *
+ * getStudentCompletedSet() returns NULL for errors
+ */
+BitSet* getStudentCompletedSet(Student *studentPtr) {
+
+	// checking for NULL pointer argument
+	if (studentPtr == NULL) {
+		printf("\nCannot get a Student's completed "
+				"Courses with NULL Student "
+				"pointer argument\n");
+		return NULL;
+	}
+
+	// rebuilding if the completed Courses changed
+	Vector *completedPtr = studentPtr->completedCourses;
+	if (studentPtr->completedSetVersion != completedPtr->version) {
+		if (studentPtr->completedSet == NULL) {
+			studentPtr->completedSet = initBitSet(0);
+		} else {
+			clearAllBits(studentPtr->completedSet);
+		}
+		for (unsigned int i = 0; i < completedPtr->numElements; i++) {
+			setBit(studentPtr->completedSet, completedPtr->elements[i].course->id);
+		}
+		studentPtr->completedSetVersion = completedPtr->version;
+	}
+	return studentPtr->completedSet;
+}
+
+/*
+ * isStudentAvailabilityInStep() takes a Student pointer as
+ * an argument and returns true if the Student's
+ * Availability is kept, was built against the current
+ * CourseBinaryTree, and has followed every change to the
+ * Student's completed Courses
+ */
+bool isStudentAvailabilityInStep(Student *studentPtr) {
+
+	return studentPtr->availability != NULL &&
+		isAvailabilityCurrent(studentPtr->availability) &&
+		studentPtr->availabilityVersion == studentPtr->completedCourses->version;
+}
+
 /*
  * addCompletedCourse() takes a Student pointer and
  * a Course pointer as arguments
  *
- * addCompletedCourse() initializes an Element
- * with the given Course pointer
- *
- * addCompletedCourse() adds a completed Course to 
- * the Student's Course pointer Vector of Elements
+ * addCompletedCourse() builds an Element with
+ * the given Course pointer directly in the 
+ * Student's Course pointer Vector of Elements,
+ * adding a completed Course to the Student
  *
  * increases Vector list capacity as necessary
  */
@@ -120,11 +262,142 @@ void addCompletedCourse(Student *studentPtr, Course *coursePtr) {
 		return;
 	}
 
-	Element* newCompletedCourse = initElement(coursePtr);
-	addElement(studentPtr->completedCourses, newCompletedCourse);
+	addCompletedCourses(studentPtr, &coursePtr, 1);
 	return;
 }	
 
+/*
+ * addCompletedCourses() takes a Student pointer, an array
+ * of Course pointers, and the number of Courses in the 
+ * array as arguments
+ *
+ * addCompletedCourses() adds all of the Courses to the
+ * Student's completed Courses with a single call to
+ * emplaceElements()
+ *
+ * if the Student's Availability is in step with the
+ * completed Courses, the completed set and the
+ * Availability are updated for each newly completed
+ * Course instead of being built again
+ */
+void addCompletedCourses(Student *studentPtr, Course **courses, int numCourses) {
+
+	// checking for null pointers
+	if (studentPtr == NULL) {
+		printf("\nCannot add Courses to Student's "
+				"completed Courses with "
+				"NULL Student pointer "
+				"argument\n");
+		return;
+	}
+	if (courses == NULL || numCourses < 0) {
+		printf("\nCannot add Courses to Student's "
+				"completed Courses without "
+				"a Course pointer array "
+				"argument\n");
+		return;
+	}
+
+	Vector *completedPtr = studentPtr->completedCourses;
+	if ( !isStudentAvailabilityInStep(studentPtr) ) {
+		emplaceElements(completedPtr, courses, numCourses);
+		return;
+	}
+
+	BitSet *completedSet = getStudentCompletedSet(studentPtr);
+	emplaceElements(completedPtr, courses, numCourses);
+	for (int i = 0; i < numCourses; i++) {
+		if ( testBit(completedSet, courses[i]->id) ) {
+			continue;
+		}
+		setBit(completedSet, courses[i]->id);
+		addCompletedToAvailability(studentPtr->availability, completedSet, courses[i]->id);
+	}
+	studentPtr->completedSetVersion = completedPtr->version;
+	studentPtr->availabilityVersion = completedPtr->version;
+	return;
+}
+
+/*
+ * removeCompletedCourses() takes a Student pointer and a
+ * BitSet pointer of Course ids as arguments
+ *
+ * removeCompletedCourses() removes the Courses from the
+ * Student's completed Courses with
+ * removeCoursesFromVector() and, if the Student's
+ * Availability is in step, clears each removed Course
+ * from the completed set and updates the Availability
+ *
+ * returns the number of Courses removed
+ */
+int removeCompletedCourses(Student *studentPtr, BitSet *courseIds) {
+
+	// checking for NULL pointer arguments
+	if (studentPtr == NULL || courseIds == NULL) {
+		printf("\nCannot remove Courses from a "
+				"Student's completed Courses "
+				"with NULL Student or BitSet "
+				"pointer argument\n");
+		return 0;
+	}
+
+	Vector *completedPtr = studentPtr->completedCourses;
+	if ( !isStudentAvailabilityInStep(studentPtr) ) {
+		return removeCoursesFromVector(completedPtr, courseIds);
+	}
+
+	BitSet *completedSet = getStudentCompletedSet(studentPtr);
+	int numRemoved = removeCoursesFromVector(completedPtr, courseIds);
+	if (numRemoved == 0) {
+		return 0;
+	}
+	for (unsigned int w = 0; w < completedSet->numWords && w < courseIds->numWords; w++) {
+		uint64_t removedBits = completedSet->words[w] & courseIds->words[w];
+		while (removedBits != 0) {
+			unsigned int courseId = w * 64 + __builtin_ctzll(removedBits);
+			removedBits &= removedBits - 1;
+			clearBit(completedSet, courseId);
+			removeCompletedFromAvailability(studentPtr->availability, completedSet, courseId);
+		}
+	}
+	studentPtr->completedSetVersion = completedPtr->version;
+	studentPtr->availabilityVersion = completedPtr->version;
+	return numRemoved;
+}
+
+/*
+ * getStudentAvailableSet() takes a Student pointer and a
+ * CourseBinaryTree pointer as arguments
+ *
+ * getStudentAvailableSet() starts keeping the Student's
+ * Availability the first time it is called, and builds
+ * it from the completed Courses whenever it is not in
+ * step with them or with the tree - otherwise the
+ * available set is returned as it is
+ *
+ * returns NULL for errors
+ */
+BitSet* getStudentAvailableSet(Student *studentPtr, CourseBinaryTree *courseTreePtr) {
+
+	// checking for NULL pointer arguments
+	if (studentPtr == NULL || courseTreePtr == NULL) {
+		printf("\nCannot get a Student's available "
+				"Courses with NULL Student or "
+				"CourseBinaryTree pointer "
+				"argument\n");
+		return NULL;
+	}
+
+	if (studentPtr->availability == NULL) {
+		studentPtr->availability = initAvailability(courseTreePtr);
+	}
+	if ( !isStudentAvailabilityInStep(studentPtr) ) {
+		buildAvailability(studentPtr->availability, getStudentCompletedSet(studentPtr));
+		studentPtr->availabilityVersion = studentPtr->completedCourses->version;
+	}
+	return studentPtr->availability->availableSet;
+}
+
 /*
  * loadStudent() takes lines, an array of strings, 
  * and numLinesInFile from a formatted input file
@@ -167,18 +440,28 @@ Student* loadStudent(char **lines, int numLinesInFile, CourseBinaryTree *courseT
 				"CourseBinaryTree pointer!\n");
 		return NULL;
 	}
-	// creating a pointer to Student
+	// creating a pointer to Student - the Degree and
+	// Course name lines are pooled, so a name every
+	// Student shares is kept once
 	Student *stuPtr = initStudent(lines[1]);
+	lines[2] = internHeapString(lines[2]);
 	setStudentDegree(stuPtr, lines[2]);
+	// every remaining line names at most one Course, so the
+	// Courses are gathered first and added all at once
+	Course **completed = (Course**) malloc( (numLinesInFile + 1) * sizeof(Course*) );
+	int numCompleted = 0;
 	// looping through student's completed courses
 	for (int j = 3; j < numLinesInFile; j++) {
 		if ( strcmp(lines[j], "") != 0) {
 			// put course on the course tree
-			Course* coursePtr = insertInCourseBinaryTree(courseTreePtr, lines[j]);
-			// link student struct to that course
-			addCompletedCourse(stuPtr, coursePtr);
+			lines[j] = internHeapString(lines[j]);
+			completed[numCompleted] = insertInCourseBinaryTree(courseTreePtr, lines[j]);
+			numCompleted++;
 		}
 	}
+	// link student struct to those courses
+	addCompletedCourses(stuPtr, completed, numCompleted);
+	free(completed);
 	return stuPtr;
 }
 
@@ -13,6 +13,11 @@
  *	full of Elements containing Course
  *	references to the CourseBinaryTree
  *
+ *	Each Student also holds a resolved 
+ *	pointer to its Degree in the DegreeVector,
+ *	so that Student queries do not have to 
+ *	search the DegreeVector by name every time
+ *
  *	All the information about a Student's 
  *	completed Courses can be accessed using
  *	said Course pointers
@@ -27,14 +32,46 @@
 
 #include "coursePtrVector.h"
 #include "courseBT.h"
+#include "degreeVector.h"
+#include "bitSet.h"
+#include "availability.h"
 
 // student struct definition
+//
+// degreePtr is the resolved Degree for the Student's 
+// degree name - Degrees never move in the DegreeVector,
+// so a Degree once found stays valid, and a NULL
+// degreePtr is only trusted while degreeVersion matches
+// the DegreeVector's version
+//
+// completedSet holds the ids of the Student's completed
+// Courses and is only valid while completedSetVersion
+// matches the version of completedCourses
+//
+// completedCourses is placed in the same allocation as
+// the Student, right after it, with inline room for
+// STUDENT_INLINE_COURSES Courses (see placeVector())
+//
+// availability is NULL until the Student's available
+// Courses are first asked for, and is kept up to date by
+// addCompletedCourse(), addCompletedCourses(), and
+// removeCompletedCourses() while availabilityVersion
+// matches the version of completedCourses
 typedef struct student {
 	char *name;
 	char *degree;
+	Degree *degreePtr;
+	unsigned int degreeVersion;
 	Vector *completedCourses;
+	BitSet *completedSet;
+	unsigned int completedSetVersion;
+	Availability *availability;
+	unsigned int availabilityVersion;
 } Student;
 
+// number of completed Courses stored inline with a Student
+#define STUDENT_INLINE_COURSES 16
+
 
 // interface
 
@@ -52,6 +89,17 @@ typedef struct student {
  */
 Student* initStudent(char* stuName);
 
+/*
+ * frees a Student, everything its
+ * completedCourses Vector has spilled
+ * to the heap, its completed Course id
+ * BitSet, and its Availability
+ *
+ * studentPtr - pointer to the Student
+ * to free
+ */
+void freeStudent(Student* studentPtr);
+
 /*
  * adds a Course to a Student's list
  * of completed Courses - using the
@@ -65,6 +113,22 @@ Student* initStudent(char* stuName);
  */
 void addCompletedCourse(Student* studentPtr, Course* coursePtr);
 
+/*
+ * adds every Course in an array to a
+ * Student's list of completed Courses,
+ * growing the Student's Vector only once
+ *
+ * studentPtr - pointer to the 
+ * Student we are adding Courses to
+ *
+ * courses - array of pointers to the
+ * Courses we are adding
+ *
+ * numCourses - number of Courses in 
+ * the array
+ */
+void addCompletedCourses(Student* studentPtr, Course** courses, int numCourses);
+
 /*
  * initializes a Student with all
  * of the information read from a
@@ -93,6 +157,77 @@ void addCompletedCourse(Student* studentPtr, Course* coursePtr);
  */
 Student* loadStudent(char** lines, int numLinesInFile, CourseBinaryTree* courseTreePtr);
 
+/*
+ * returns a pointer to the Student's Degree
+ * in the DegreeVector
+ *
+ * the Degree is looked up by name only when
+ * the Student has not resolved it yet or when
+ * the DegreeVector has changed since it was 
+ * last resolved - otherwise the Student's
+ * stored Degree pointer is returned directly
+ *
+ * returns NULL if the Student's Degree is not
+ * in the DegreeVector or for any error
+ *
+ * studentPtr - pointer to the Student whose
+ * Degree we want
+ *
+ * degListPtr - pointer to the DegreeVector
+ * the Degree is resolved against
+ */
+Degree* getStudentDegree(Student* studentPtr, DegreeVector* degListPtr);
+
+/*
+ * returns the ids of the Student's completed
+ * Courses as a BitSet
+ *
+ * the BitSet is only rebuilt from the Student's
+ * completed Courses when they have changed since
+ * it was last built
+ *
+ * returns NULL for any error
+ *
+ * studentPtr - pointer to the Student whose
+ * completed Courses we want
+ */
+BitSet* getStudentCompletedSet(Student* studentPtr);
+
+/*
+ * removes every completed Course with an
+ * id in the BitSet from a Student's
+ * completed Courses, updating the
+ * Student's available Courses if they
+ * are kept
+ *
+ * returns the number of Courses removed
+ *
+ * studentPtr - pointer to the Student
+ *
+ * courseIds - pointer to the BitSet of
+ * ids of the Courses to remove
+ */
+int removeCompletedCourses(Student* studentPtr, BitSet* courseIds);
+
+/*
+ * returns the ids of the Courses the
+ * Student can take next - not completed,
+ * with every prerequisite fulfilled
+ *
+ * the first call starts keeping the
+ * Student's Availability, and later
+ * calls only read it, building it again
+ * only if it has fallen out of step
+ *
+ * returns NULL for any error
+ *
+ * studentPtr - pointer to the Student
+ *
+ * courseTreePtr - pointer to the
+ * CourseBinaryTree of every Course
+ */
+BitSet* getStudentAvailableSet(Student* studentPtr, CourseBinaryTree* courseTreePtr);
+
 /*
  * prints all of a Student's 
  * information, including:
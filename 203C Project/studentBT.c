@@ -80,9 +80,43 @@ StudentBinaryTree* createStudentBinaryTree() {
 
 	StudentBinaryTree *newTree = (StudentBinaryTree*) malloc(sizeof(StudentBinaryTree));
 	newTree->root = NULL;
+	newTree->size = 0;
+	newTree->version = 0;
 	return newTree;
 }
 
+/*
+ * freeStudentBTNodes() takes a StudentBTNode pointer as
+ * an argument and frees every StudentBTNode of the
+ * subtree and its Student, children first
+ */
+void freeStudentBTNodes(StudentBTNode *nodePtr) {
+
+	if (nodePtr == NULL) {
+		return;
+	}
+	freeStudentBTNodes(nodePtr->left);
+	freeStudentBTNodes(nodePtr->right);
+	freeStudent(nodePtr->studentPtr);
+	free(nodePtr);
+	return;
+}
+
+/*
+ * freeStudentBinaryTree() takes a StudentBinaryTree
+ * pointer as an argument and frees every StudentBTNode
+ * and Student on the tree, and then the tree
+ */
+void freeStudentBinaryTree(StudentBinaryTree *bt) {
+
+	if (bt == NULL) {
+		return;
+	}
+	freeStudentBTNodes(bt->root);
+	free(bt);
+	return;
+}
+
 /*
  * findInStudentBinaryTree() takes a 
  * StudentBTNode pointer and a C string
@@ -168,6 +202,8 @@ void insertInStudentBinaryTree( StudentBinaryTree* bt, Student* newStudentPtr )
 	// binary tree is empty - add root
 	if (bt->root == NULL) {
 		bt->root = newNode;
+		bt->size++;
+		bt->version++;
 		return;
 	}
 	// searching for appropriate place in the BT for the new node
@@ -186,9 +222,13 @@ void insertInStudentBinaryTree( StudentBinaryTree* bt, Student* newStudentPtr )
 	// newNode is linked to the left of nodePtr
 	if (strcmp(studentName, nodePtr->studentPtr->name) < 0) {
 		nodePtr->left = newNode;
+		bt->size++;
+		bt->version++;
 	// newNode is linked to the right of nodePtr
 	} else if (strcmp(studentName, nodePtr->studentPtr->name) > 0) {
 		nodePtr->right = newNode;
+		bt->size++;
+		bt->version++;
 	// found node with the same name as studentName
 	} else if (strcmp(studentName, nodePtr->studentPtr->name) == 0) {
 		free(newNode);
@@ -304,6 +344,7 @@ void removeCompletedCourseFromAllStudents( StudentBinaryTree *bt, char *courseNa
 	// specified completed Course
 	if (bt->root != NULL) {
 		traverseAndRemoveCompletedCourse(bt->root, courseName);
+		bt->version++;
 		return;
 	} else {
 		printf("\nCannot remove %s Course from "
@@ -313,3 +354,124 @@ void removeCompletedCourseFromAllStudents( StudentBinaryTree *bt, char *courseNa
 		return;
 	}
 }
+
+/*
+ * traverseAndRemoveCompletedCourses() takes a 
+ * StudentBTNode pointer and a BitSet pointer
+ * of Course ids as arguments
+ *
+ * traverseAndRemoveCompletedCourses() traverses
+ * the tree/subtree in order and removes the
+ * Courses from each Student's completed Courses
+ * with removeCompletedCourses(), printing the
+ * Student's information if any were removed
+ */
+void traverseAndRemoveCompletedCourses(StudentBTNode *nodePtr, BitSet *courseIds) {
+
+	// passed leaf node
+	if (nodePtr == NULL) {
+		return;
+	}
+
+	traverseAndRemoveCompletedCourses(nodePtr->left, courseIds);
+	if ( removeCompletedCourses(nodePtr->studentPtr, courseIds) > 0 ) {
+		printStudent(nodePtr->studentPtr);
+	}
+	traverseAndRemoveCompletedCourses(nodePtr->right, courseIds);
+	return;
+}
+
+/*
+ * removeCompletedCoursesFromAllStudents() 
+ * takes a StudentBinaryTree pointer and a
+ * BitSet pointer of Course ids as arguments
+ *
+ * removeCompletedCoursesFromAllStudents()
+ * removes every completed Course with an id
+ * in the BitSet from every Student in the
+ * StudentBinaryTree
+ */
+void removeCompletedCoursesFromAllStudents(StudentBinaryTree *bt, BitSet *courseIds) {
+
+	// checking for NULL pointer arguments
+	if (courseIds == NULL) {
+		printf("\nCannot remove Courses from "
+				"all Student's completed "
+				"Courses with no Course "
+				"id set argument\n");
+		return;
+	}
+	if (bt == NULL) {
+		printf("\nCannot remove Courses from "
+				"all Student's completed "
+				"Courses with NULL "
+				"StudentBinaryTree pointer "
+				"argument\n");
+		return;
+	}
+
+	// checking for empty tree and removing
+	// specified completed Courses
+	if (bt->root != NULL) {
+		traverseAndRemoveCompletedCourses(bt->root, courseIds);
+		bt->version++;
+		return;
+	} else {
+		printf("\nCannot remove Courses from "
+				"all Student's completed "
+				"Courses with empty "
+				"StudentBinaryTree\n");
+		return;
+	}
+}
+
+/*
+ * traverseAndResolveDegree() takes a StudentBTNode
+ * pointer and a DegreeVector pointer as arguments
+ *
+ * traverseAndResolveDegree() is a recursive helper
+ * function for resolveAllStudentDegrees() that calls
+ * getStudentDegree() for every Student in the 
+ * tree/subtree starting at nodePtr
+ */
+void traverseAndResolveDegree(StudentBTNode *nodePtr, DegreeVector *degListPtr) {
+
+	// passed leaf node
+	if (nodePtr == NULL) {
+		return;
+	}
+
+	traverseAndResolveDegree(nodePtr->left, degListPtr);
+	getStudentDegree(nodePtr->studentPtr, degListPtr);
+	traverseAndResolveDegree(nodePtr->right, degListPtr);
+	return;
+}
+
+/*
+ * resolveAllStudentDegrees() takes a StudentBinaryTree
+ * pointer and a DegreeVector pointer as arguments
+ *
+ * resolveAllStudentDegrees() resolves the Degree 
+ * pointer of every Student on the StudentBinaryTree
+ * so that Students loaded before their Degree file
+ * are linked to their Degree once loading is done
+ */
+void resolveAllStudentDegrees(StudentBinaryTree *bt, DegreeVector *degListPtr) {
+
+	// checking for NULL pointer arguments
+	if (bt == NULL) {
+		printf("\nCannot resolve Students' Degrees "
+				"with NULL StudentBinaryTree "
+				"pointer argument\n");
+		return;
+	}
+	if (degListPtr == NULL) {
+		printf("\nCannot resolve Students' Degrees "
+				"with NULL DegreeVector "
+				"pointer argument\n");
+		return;
+	}
+
+	traverseAndResolveDegree(bt->root, degListPtr);
+	return;
+}
@@ -39,9 +39,16 @@ typedef struct studentBTNode {
 } StudentBTNode;
 
 // Student tree struct
+//
+// size is the number of Students on the tree and 
+// version is bumped every time a Student is added 
+// or a Student's completed Courses are changed 
+// through the tree, so that structures built from 
+// the tree can tell when they are out of date
 typedef struct studentBinaryTree {
 	StudentBTNode *root;
 	int size;
+	unsigned int version;
 } StudentBinaryTree;
 
 
@@ -65,6 +72,15 @@ StudentBTNode* createStudentBTNode(Student* newStudentPtr);
  */
 StudentBinaryTree* createStudentBinaryTree();
 
+/*
+ * frees a StudentBinaryTree, its
+ * StudentBTNodes, and their Students
+ *
+ * bt - pointer to the StudentBinaryTree
+ * to free
+ */
+void freeStudentBinaryTree(StudentBinaryTree* bt);
+
 /* 
  * recursively searches the tree starting
  * at rootPtr for a Student with the name
@@ -121,4 +137,31 @@ void printStudentBinaryTreeInOrder(StudentBTNode* stuNodePtr);
  */
 void removeCompletedCourseFromAllStudents(StudentBinaryTree* bt, char* courseName);
 
+/*
+ * removes every completed Course whose id
+ * is set in the given BitSet from all 
+ * Students in the StudentBinaryTree, 
+ * compacting each Student's completed
+ * Courses once, and prints every Student
+ * that changed
+ *
+ * bt - pointer to the StudentBinaryTree
+ *
+ * courseIds - pointer to the BitSet of the
+ * ids of the Courses we want to remove
+ */
+void removeCompletedCoursesFromAllStudents(StudentBinaryTree* bt, BitSet* courseIds);
+
+/*
+ * resolves every Student's Degree pointer in 
+ * the StudentBinaryTree against the DegreeVector
+ * (see getStudentDegree() in student.h)
+ *
+ * bt - pointer to the StudentBinaryTree
+ *
+ * degListPtr - pointer to the DegreeVector
+ * the Students' Degrees are resolved against
+ */
+void resolveAllStudentDegrees(StudentBinaryTree* bt, DegreeVector* degListPtr);
+
 #endif
@@ -14,6 +14,8 @@
 #include "departmentVector.h"
 #include "degreeVector.h"
 #include "studentBT.h"
+#include "completionStore.h"
+#include "auditCache.h"
 
 #include "stringFunctions.h"
 #include "userInterface.h"
@@ -122,18 +124,76 @@ void handleCmdP(char **userInputPtr, CourseBinaryTree *courseTreePtr, Department
 	return;
 }
 
+/*
+ * handleCmdT() takes a pointer to a string,
+ * userInputPtr, a CourseBinaryTree pointer,
+ * courseTreePtr, a StudentBinaryTree pointer,
+ * studentTreePtr, and a CompletionStore
+ * pointer, completionStorePtr
+ *
+ * handleCmdT() handles all user input 
+ * starting with the 't' (tally) command
+ *
+ * handleCmdT() refreshes the CompletionStore
+ * (it is only rebuilt if the StudentBinaryTree
+ * changed) and gets the second command 
+ * character from the user's string
+ */
+void handleCmdT(char **userInputPtr, CourseBinaryTree *courseTreePtr, StudentBinaryTree *studentTreePtr, CompletionStore *completionStorePtr) {
+
+	char **stringArray = NULL;
+	int numStrings = 0;
+
+	refreshCompletionStore(completionStorePtr, studentTreePtr, courseTreePtr);
+	// new command character for t commands
+	char commandChar = removeCommandChar(userInputPtr);	
+	// handling cases depending on user input
+	switch( commandChar ) {
+
+		case 'a' :
+			tallyAllCourseCompletions(courseTreePtr, completionStorePtr);
+			break;
+
+		case 'c' :
+			tallyCourseCompletions(courseTreePtr, completionStorePtr, *userInputPtr);
+			break;
+
+		case 'd' :
+			tallyCourseCompletionsByDegree(courseTreePtr, completionStorePtr, *userInputPtr);
+			break;
+
+		case 'b' :
+			stringArray = NULL;
+			numStrings = splitStringAtComma(*userInputPtr, &stringArray);
+			tallyJointCourseCompletions(courseTreePtr, completionStorePtr, stringArray, numStrings);
+			break;
+
+		default :
+			printf("\nwrong input command!\n");
+	}
+	// the split strings stay in the user's input - only
+	// their array is freed
+	free(stringArray);
+
+	// shifting userInput back to original location (from removeCommandChar)
+	*userInputPtr -= 2;
+	return;
+}
+
 /*
  * processUserInput() takes a command character from the user,
  * the rest of the string input, a reference to the 
  * CourseBinaryTree, a reference to the list of Departments, 
- * a reference to the list of Degrees, and a reference to the 
- * the Student binary tree as arguments
+ * a reference to the list of Degrees, a reference to the 
+ * the Student binary tree, a reference to the 
+ * CompletionStore, and a reference to the AuditCache
+ * as arguments
  *
  * processUserInput() parses the user's command while the program is running
  * and executes the appropriate functions
  * this includes updating data structures, printing information, and more 
  */
-void processUserInput(char commandChar, char **userInputPtr, CourseBinaryTree *courseTreePtr, DepartmentVector *depListPtr, DegreeVector *degListPtr, StudentBinaryTree *studentTreePtr) {
+void processUserInput(char commandChar, char **userInputPtr, CourseBinaryTree *courseTreePtr, DepartmentVector *depListPtr, DegreeVector *degListPtr, StudentBinaryTree *studentTreePtr, CompletionStore *completionStorePtr, AuditCache *auditCachePtr) {
 
 	char **stringArray = NULL;
 	int numStrings = 0;
@@ -159,17 +219,17 @@ void processUserInput(char commandChar, char **userInputPtr, CourseBinaryTree *c
 			break;
 		case 'm' :
 			// student required courses
-			studentCoursesStillNeeded(degListPtr, studentTreePtr, *userInputPtr);
+			studentCoursesStillNeeded(courseTreePtr, degListPtr, studentTreePtr, auditCachePtr, *userInputPtr);
 			break;
 		case 'n' :
 			// student available courses
-			showAvailableCoursesForStudent(degListPtr, studentTreePtr, *userInputPtr);
+			showAvailableCoursesForStudent(courseTreePtr, degListPtr, studentTreePtr, auditCachePtr, *userInputPtr);
 			break;
 		case 'r' :
-			// remove course
+			// remove course(s)
 			stringArray = NULL;
 			numStrings = splitStringAtComma(*userInputPtr, &stringArray);
-			removeCourseFromAll(courseTreePtr, depListPtr, degListPtr, studentTreePtr, stringArray);
+			removeCoursesFromAll(courseTreePtr, depListPtr, degListPtr, studentTreePtr, stringArray, numStrings);
 			break;
 		case 'p' :
 			handleCmdP(userInputPtr, courseTreePtr, depListPtr, degListPtr, studentTreePtr);
@@ -180,6 +240,51 @@ void processUserInput(char commandChar, char **userInputPtr, CourseBinaryTree *c
 			numStrings = splitStringAtComma(*userInputPtr, &stringArray);
 			removeCourseFromDegree(degListPtr, stringArray);
 			break;
+		case 't' :
+			handleCmdT(userInputPtr, courseTreePtr, studentTreePtr, completionStorePtr);
+			break;
+		case 'e' :
+			// transitive prerequisites of a course
+			stringArray = NULL;
+			numStrings = splitStringAtComma(*userInputPtr, &stringArray);
+			printPrerequisiteChain(courseTreePtr, studentTreePtr, stringArray, numStrings);
+			break;
+		case 'g' :
+			// term-by-term graduation plan
+			stringArray = NULL;
+			numStrings = splitStringAtComma(*userInputPtr, &stringArray);
+			planStudentGraduation(courseTreePtr, degListPtr, studentTreePtr, stringArray, numStrings);
+			break;
+		case 'w' :
+			// what completing course(s) would change
+			stringArray = NULL;
+			numStrings = splitStringAtComma(*userInputPtr, &stringArray);
+			showWhatIfCompleted(courseTreePtr, degListPtr, studentTreePtr, stringArray, numStrings);
+			break;
+		case 'v' :
+			// available courses of every student at once
+			tallyAvailableCourses(courseTreePtr, degListPtr, studentTreePtr, completionStorePtr);
+			break;
+		case 'b' :
+			// audit of every student, written to a file
+			stringArray = NULL;
+			numStrings = splitStringAtComma(*userInputPtr, &stringArray);
+			auditAllStudents(courseTreePtr, degListPtr, studentTreePtr, completionStorePtr, stringArray, numStrings);
+			break;
+		case 'k' :
+			// students closest to graduation
+			stringArray = NULL;
+			numStrings = splitStringAtComma(*userInputPtr, &stringArray);
+			rankStudentsByGraduation(courseTreePtr, degListPtr, studentTreePtr, completionStorePtr, stringArray, numStrings);
+			break;
+		case 'j' :
+			// student audited against every degree
+			compareStudentAcrossDegrees(degListPtr, studentTreePtr, *userInputPtr);
+			break;
+		case 'i' :
+			// hits and misses of the m and n results cache
+			printAuditCacheStats(auditCachePtr);
+			break;
 		case 'x' :
 			printf("\nExiting...\n");
 			break;
@@ -187,6 +292,10 @@ void processUserInput(char commandChar, char **userInputPtr, CourseBinaryTree *c
 			printf("\nwrong input command!\n");
 	}
 
+	// the split strings stay in the user's input - only
+	// their array is freed
+	free(stringArray);
+
 	// shifting userInput back to original location (from removeCommandChar)
 	*userInputPtr -= 2;
 	return;
@@ -52,7 +52,14 @@ char getUserInput(char** userInputPtr);
  * studentTreePtr - pointer to the
  * StudentBinaryTree for Student 
  * accesses in the program
+ *
+ * completionStorePtr - pointer to the
+ * CompletionStore used for population
+ * level Course completion counts
+ *
+ * auditCachePtr - pointer to the
+ * AuditCache of m and n results
  */
-void processUserInput(char commandChar, char** userInputPtr, CourseBinaryTree* courseTreePtr, DepartmentVector* depListPtr, DegreeVector* degListPtr, StudentBinaryTree* studentTreePtr);
+void processUserInput(char commandChar, char** userInputPtr, CourseBinaryTree* courseTreePtr, DepartmentVector* depListPtr, DegreeVector* degListPtr, StudentBinaryTree* studentTreePtr, CompletionStore* completionStorePtr, AuditCache* auditCachePtr);
 
 #endif